@@ -1,872 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: abd.proto
-#ifndef GRPC_abd_2eproto__INCLUDED
-#define GRPC_abd_2eproto__INCLUDED
-
-#include "abd.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-
-namespace abd {
-
-// ---------- ABD Service ----------
-//
-class ABDService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "abd.ABDService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status WriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::abd::WriteQueryReply* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::WriteQueryReply>> AsyncWriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::WriteQueryReply>>(AsyncWriteQueryRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::WriteQueryReply>> PrepareAsyncWriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::WriteQueryReply>>(PrepareAsyncWriteQueryRaw(context, request, cq));
-    }
-    virtual ::grpc::Status ReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::abd::ReadQueryReply* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReadQueryReply>> AsyncReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReadQueryReply>>(AsyncReadQueryRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReadQueryReply>> PrepareAsyncReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReadQueryReply>>(PrepareAsyncReadQueryRaw(context, request, cq));
-    }
-    virtual ::grpc::Status WriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::abd::Ack* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::Ack>> AsyncWriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::Ack>>(AsyncWritePropRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::Ack>> PrepareAsyncWriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::Ack>>(PrepareAsyncWritePropRaw(context, request, cq));
-    }
-    virtual ::grpc::Status AcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::abd::AcquireLockReply* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::AcquireLockReply>> AsyncAcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::AcquireLockReply>>(AsyncAcquireLockRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::AcquireLockReply>> PrepareAsyncAcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::AcquireLockReply>>(PrepareAsyncAcquireLockRaw(context, request, cq));
-    }
-    virtual ::grpc::Status ReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::abd::ReleaseLockReply* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReleaseLockReply>> AsyncReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReleaseLockReply>>(AsyncReleaseLockRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReleaseLockReply>> PrepareAsyncReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReleaseLockReply>>(PrepareAsyncReleaseLockRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void WriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest* request, ::abd::WriteQueryReply* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void WriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest* request, ::abd::WriteQueryReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void ReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest* request, ::abd::ReadQueryReply* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest* request, ::abd::ReadQueryReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void WriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest* request, ::abd::Ack* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void WriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest* request, ::abd::Ack* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void AcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest* request, ::abd::AcquireLockReply* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void AcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest* request, ::abd::AcquireLockReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void ReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest* request, ::abd::ReleaseLockReply* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest* request, ::abd::ReleaseLockReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::WriteQueryReply>* AsyncWriteQueryRaw(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::WriteQueryReply>* PrepareAsyncWriteQueryRaw(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReadQueryReply>* AsyncReadQueryRaw(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReadQueryReply>* PrepareAsyncReadQueryRaw(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::Ack>* AsyncWritePropRaw(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::Ack>* PrepareAsyncWritePropRaw(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::AcquireLockReply>* AsyncAcquireLockRaw(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::AcquireLockReply>* PrepareAsyncAcquireLockRaw(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReleaseLockReply>* AsyncReleaseLockRaw(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::abd::ReleaseLockReply>* PrepareAsyncReleaseLockRaw(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status WriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::abd::WriteQueryReply* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::WriteQueryReply>> AsyncWriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::WriteQueryReply>>(AsyncWriteQueryRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::WriteQueryReply>> PrepareAsyncWriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::WriteQueryReply>>(PrepareAsyncWriteQueryRaw(context, request, cq));
-    }
-    ::grpc::Status ReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::abd::ReadQueryReply* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::ReadQueryReply>> AsyncReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::ReadQueryReply>>(AsyncReadQueryRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::ReadQueryReply>> PrepareAsyncReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::ReadQueryReply>>(PrepareAsyncReadQueryRaw(context, request, cq));
-    }
-    ::grpc::Status WriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::abd::Ack* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::Ack>> AsyncWriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::Ack>>(AsyncWritePropRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::Ack>> PrepareAsyncWriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::Ack>>(PrepareAsyncWritePropRaw(context, request, cq));
-    }
-    ::grpc::Status AcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::abd::AcquireLockReply* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::AcquireLockReply>> AsyncAcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::AcquireLockReply>>(AsyncAcquireLockRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::AcquireLockReply>> PrepareAsyncAcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::AcquireLockReply>>(PrepareAsyncAcquireLockRaw(context, request, cq));
-    }
-    ::grpc::Status ReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::abd::ReleaseLockReply* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::ReleaseLockReply>> AsyncReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::ReleaseLockReply>>(AsyncReleaseLockRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::ReleaseLockReply>> PrepareAsyncReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::abd::ReleaseLockReply>>(PrepareAsyncReleaseLockRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void WriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest* request, ::abd::WriteQueryReply* response, std::function<void(::grpc::Status)>) override;
-      void WriteQuery(::grpc::ClientContext* context, const ::abd::WriteQueryRequest* request, ::abd::WriteQueryReply* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void ReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest* request, ::abd::ReadQueryReply* response, std::function<void(::grpc::Status)>) override;
-      void ReadQuery(::grpc::ClientContext* context, const ::abd::ReadQueryRequest* request, ::abd::ReadQueryReply* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void WriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest* request, ::abd::Ack* response, std::function<void(::grpc::Status)>) override;
-      void WriteProp(::grpc::ClientContext* context, const ::abd::WritePropRequest* request, ::abd::Ack* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void AcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest* request, ::abd::AcquireLockReply* response, std::function<void(::grpc::Status)>) override;
-      void AcquireLock(::grpc::ClientContext* context, const ::abd::AcquireLockRequest* request, ::abd::AcquireLockReply* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void ReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest* request, ::abd::ReleaseLockReply* response, std::function<void(::grpc::Status)>) override;
-      void ReleaseLock(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest* request, ::abd::ReleaseLockReply* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::abd::WriteQueryReply>* AsyncWriteQueryRaw(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::WriteQueryReply>* PrepareAsyncWriteQueryRaw(::grpc::ClientContext* context, const ::abd::WriteQueryRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::ReadQueryReply>* AsyncReadQueryRaw(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::ReadQueryReply>* PrepareAsyncReadQueryRaw(::grpc::ClientContext* context, const ::abd::ReadQueryRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::Ack>* AsyncWritePropRaw(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::Ack>* PrepareAsyncWritePropRaw(::grpc::ClientContext* context, const ::abd::WritePropRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::AcquireLockReply>* AsyncAcquireLockRaw(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::AcquireLockReply>* PrepareAsyncAcquireLockRaw(::grpc::ClientContext* context, const ::abd::AcquireLockRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::ReleaseLockReply>* AsyncReleaseLockRaw(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::abd::ReleaseLockReply>* PrepareAsyncReleaseLockRaw(::grpc::ClientContext* context, const ::abd::ReleaseLockRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_WriteQuery_;
-    const ::grpc::internal::RpcMethod rpcmethod_ReadQuery_;
-    const ::grpc::internal::RpcMethod rpcmethod_WriteProp_;
-    const ::grpc::internal::RpcMethod rpcmethod_AcquireLock_;
-    const ::grpc::internal::RpcMethod rpcmethod_ReleaseLock_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status WriteQuery(::grpc::ServerContext* context, const ::abd::WriteQueryRequest* request, ::abd::WriteQueryReply* response);
-    virtual ::grpc::Status ReadQuery(::grpc::ServerContext* context, const ::abd::ReadQueryRequest* request, ::abd::ReadQueryReply* response);
-    virtual ::grpc::Status WriteProp(::grpc::ServerContext* context, const ::abd::WritePropRequest* request, ::abd::Ack* response);
-    virtual ::grpc::Status AcquireLock(::grpc::ServerContext* context, const ::abd::AcquireLockRequest* request, ::abd::AcquireLockReply* response);
-    virtual ::grpc::Status ReleaseLock(::grpc::ServerContext* context, const ::abd::ReleaseLockRequest* request, ::abd::ReleaseLockReply* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_WriteQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_WriteQuery() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_WriteQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteQuery(::grpc::ServerContext* /*context*/, const ::abd::WriteQueryRequest* /*request*/, ::abd::WriteQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestWriteQuery(::grpc::ServerContext* context, ::abd::WriteQueryRequest* request, ::grpc::ServerAsyncResponseWriter< ::abd::WriteQueryReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_ReadQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_ReadQuery() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_ReadQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReadQuery(::grpc::ServerContext* /*context*/, const ::abd::ReadQueryRequest* /*request*/, ::abd::ReadQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestReadQuery(::grpc::ServerContext* context, ::abd::ReadQueryRequest* request, ::grpc::ServerAsyncResponseWriter< ::abd::ReadQueryReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_WriteProp : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_WriteProp() {
-      ::grpc::Service::MarkMethodAsync(2);
-    }
-    ~WithAsyncMethod_WriteProp() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteProp(::grpc::ServerContext* /*context*/, const ::abd::WritePropRequest* /*request*/, ::abd::Ack* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestWriteProp(::grpc::ServerContext* context, ::abd::WritePropRequest* request, ::grpc::ServerAsyncResponseWriter< ::abd::Ack>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_AcquireLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_AcquireLock() {
-      ::grpc::Service::MarkMethodAsync(3);
-    }
-    ~WithAsyncMethod_AcquireLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status AcquireLock(::grpc::ServerContext* /*context*/, const ::abd::AcquireLockRequest* /*request*/, ::abd::AcquireLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestAcquireLock(::grpc::ServerContext* context, ::abd::AcquireLockRequest* request, ::grpc::ServerAsyncResponseWriter< ::abd::AcquireLockReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_ReleaseLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_ReleaseLock() {
-      ::grpc::Service::MarkMethodAsync(4);
-    }
-    ~WithAsyncMethod_ReleaseLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReleaseLock(::grpc::ServerContext* /*context*/, const ::abd::ReleaseLockRequest* /*request*/, ::abd::ReleaseLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestReleaseLock(::grpc::ServerContext* context, ::abd::ReleaseLockRequest* request, ::grpc::ServerAsyncResponseWriter< ::abd::ReleaseLockReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_WriteQuery<WithAsyncMethod_ReadQuery<WithAsyncMethod_WriteProp<WithAsyncMethod_AcquireLock<WithAsyncMethod_ReleaseLock<Service > > > > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_WriteQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_WriteQuery() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::abd::WriteQueryRequest, ::abd::WriteQueryReply>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::abd::WriteQueryRequest* request, ::abd::WriteQueryReply* response) { return this->WriteQuery(context, request, response); }));}
-    void SetMessageAllocatorFor_WriteQuery(
-        ::grpc::MessageAllocator< ::abd::WriteQueryRequest, ::abd::WriteQueryReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::abd::WriteQueryRequest, ::abd::WriteQueryReply>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_WriteQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteQuery(::grpc::ServerContext* /*context*/, const ::abd::WriteQueryRequest* /*request*/, ::abd::WriteQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* WriteQuery(
-      ::grpc::CallbackServerContext* /*context*/, const ::abd::WriteQueryRequest* /*request*/, ::abd::WriteQueryReply* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_ReadQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_ReadQuery() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::abd::ReadQueryRequest, ::abd::ReadQueryReply>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::abd::ReadQueryRequest* request, ::abd::ReadQueryReply* response) { return this->ReadQuery(context, request, response); }));}
-    void SetMessageAllocatorFor_ReadQuery(
-        ::grpc::MessageAllocator< ::abd::ReadQueryRequest, ::abd::ReadQueryReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::abd::ReadQueryRequest, ::abd::ReadQueryReply>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_ReadQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReadQuery(::grpc::ServerContext* /*context*/, const ::abd::ReadQueryRequest* /*request*/, ::abd::ReadQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ReadQuery(
-      ::grpc::CallbackServerContext* /*context*/, const ::abd::ReadQueryRequest* /*request*/, ::abd::ReadQueryReply* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_WriteProp : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_WriteProp() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::abd::WritePropRequest, ::abd::Ack>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::abd::WritePropRequest* request, ::abd::Ack* response) { return this->WriteProp(context, request, response); }));}
-    void SetMessageAllocatorFor_WriteProp(
-        ::grpc::MessageAllocator< ::abd::WritePropRequest, ::abd::Ack>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::abd::WritePropRequest, ::abd::Ack>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_WriteProp() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteProp(::grpc::ServerContext* /*context*/, const ::abd::WritePropRequest* /*request*/, ::abd::Ack* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* WriteProp(
-      ::grpc::CallbackServerContext* /*context*/, const ::abd::WritePropRequest* /*request*/, ::abd::Ack* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_AcquireLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_AcquireLock() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::abd::AcquireLockRequest, ::abd::AcquireLockReply>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::abd::AcquireLockRequest* request, ::abd::AcquireLockReply* response) { return this->AcquireLock(context, request, response); }));}
-    void SetMessageAllocatorFor_AcquireLock(
-        ::grpc::MessageAllocator< ::abd::AcquireLockRequest, ::abd::AcquireLockReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::abd::AcquireLockRequest, ::abd::AcquireLockReply>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_AcquireLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status AcquireLock(::grpc::ServerContext* /*context*/, const ::abd::AcquireLockRequest* /*request*/, ::abd::AcquireLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* AcquireLock(
-      ::grpc::CallbackServerContext* /*context*/, const ::abd::AcquireLockRequest* /*request*/, ::abd::AcquireLockReply* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_ReleaseLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_ReleaseLock() {
-      ::grpc::Service::MarkMethodCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::abd::ReleaseLockRequest, ::abd::ReleaseLockReply>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::abd::ReleaseLockRequest* request, ::abd::ReleaseLockReply* response) { return this->ReleaseLock(context, request, response); }));}
-    void SetMessageAllocatorFor_ReleaseLock(
-        ::grpc::MessageAllocator< ::abd::ReleaseLockRequest, ::abd::ReleaseLockReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::abd::ReleaseLockRequest, ::abd::ReleaseLockReply>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_ReleaseLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReleaseLock(::grpc::ServerContext* /*context*/, const ::abd::ReleaseLockRequest* /*request*/, ::abd::ReleaseLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ReleaseLock(
-      ::grpc::CallbackServerContext* /*context*/, const ::abd::ReleaseLockRequest* /*request*/, ::abd::ReleaseLockReply* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_WriteQuery<WithCallbackMethod_ReadQuery<WithCallbackMethod_WriteProp<WithCallbackMethod_AcquireLock<WithCallbackMethod_ReleaseLock<Service > > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_WriteQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_WriteQuery() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_WriteQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteQuery(::grpc::ServerContext* /*context*/, const ::abd::WriteQueryRequest* /*request*/, ::abd::WriteQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_ReadQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_ReadQuery() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_ReadQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReadQuery(::grpc::ServerContext* /*context*/, const ::abd::ReadQueryRequest* /*request*/, ::abd::ReadQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_WriteProp : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_WriteProp() {
-      ::grpc::Service::MarkMethodGeneric(2);
-    }
-    ~WithGenericMethod_WriteProp() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteProp(::grpc::ServerContext* /*context*/, const ::abd::WritePropRequest* /*request*/, ::abd::Ack* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_AcquireLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_AcquireLock() {
-      ::grpc::Service::MarkMethodGeneric(3);
-    }
-    ~WithGenericMethod_AcquireLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status AcquireLock(::grpc::ServerContext* /*context*/, const ::abd::AcquireLockRequest* /*request*/, ::abd::AcquireLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_ReleaseLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_ReleaseLock() {
-      ::grpc::Service::MarkMethodGeneric(4);
-    }
-    ~WithGenericMethod_ReleaseLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReleaseLock(::grpc::ServerContext* /*context*/, const ::abd::ReleaseLockRequest* /*request*/, ::abd::ReleaseLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_WriteQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_WriteQuery() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_WriteQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteQuery(::grpc::ServerContext* /*context*/, const ::abd::WriteQueryRequest* /*request*/, ::abd::WriteQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestWriteQuery(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_ReadQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_ReadQuery() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_ReadQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReadQuery(::grpc::ServerContext* /*context*/, const ::abd::ReadQueryRequest* /*request*/, ::abd::ReadQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestReadQuery(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_WriteProp : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_WriteProp() {
-      ::grpc::Service::MarkMethodRaw(2);
-    }
-    ~WithRawMethod_WriteProp() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteProp(::grpc::ServerContext* /*context*/, const ::abd::WritePropRequest* /*request*/, ::abd::Ack* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestWriteProp(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_AcquireLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_AcquireLock() {
-      ::grpc::Service::MarkMethodRaw(3);
-    }
-    ~WithRawMethod_AcquireLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status AcquireLock(::grpc::ServerContext* /*context*/, const ::abd::AcquireLockRequest* /*request*/, ::abd::AcquireLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestAcquireLock(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_ReleaseLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_ReleaseLock() {
-      ::grpc::Service::MarkMethodRaw(4);
-    }
-    ~WithRawMethod_ReleaseLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReleaseLock(::grpc::ServerContext* /*context*/, const ::abd::ReleaseLockRequest* /*request*/, ::abd::ReleaseLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestReleaseLock(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_WriteQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_WriteQuery() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteQuery(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_WriteQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteQuery(::grpc::ServerContext* /*context*/, const ::abd::WriteQueryRequest* /*request*/, ::abd::WriteQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* WriteQuery(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_ReadQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_ReadQuery() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadQuery(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_ReadQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReadQuery(::grpc::ServerContext* /*context*/, const ::abd::ReadQueryRequest* /*request*/, ::abd::ReadQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ReadQuery(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_WriteProp : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_WriteProp() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteProp(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_WriteProp() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status WriteProp(::grpc::ServerContext* /*context*/, const ::abd::WritePropRequest* /*request*/, ::abd::Ack* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* WriteProp(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_AcquireLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_AcquireLock() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->AcquireLock(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_AcquireLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status AcquireLock(::grpc::ServerContext* /*context*/, const ::abd::AcquireLockRequest* /*request*/, ::abd::AcquireLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* AcquireLock(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_ReleaseLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_ReleaseLock() {
-      ::grpc::Service::MarkMethodRawCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReleaseLock(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_ReleaseLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ReleaseLock(::grpc::ServerContext* /*context*/, const ::abd::ReleaseLockRequest* /*request*/, ::abd::ReleaseLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ReleaseLock(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_WriteQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_WriteQuery() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::abd::WriteQueryRequest, ::abd::WriteQueryReply>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::abd::WriteQueryRequest, ::abd::WriteQueryReply>* streamer) {
-                       return this->StreamedWriteQuery(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_WriteQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status WriteQuery(::grpc::ServerContext* /*context*/, const ::abd::WriteQueryRequest* /*request*/, ::abd::WriteQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedWriteQuery(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::abd::WriteQueryRequest,::abd::WriteQueryReply>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_ReadQuery : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_ReadQuery() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::abd::ReadQueryRequest, ::abd::ReadQueryReply>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::abd::ReadQueryRequest, ::abd::ReadQueryReply>* streamer) {
-                       return this->StreamedReadQuery(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_ReadQuery() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status ReadQuery(::grpc::ServerContext* /*context*/, const ::abd::ReadQueryRequest* /*request*/, ::abd::ReadQueryReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedReadQuery(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::abd::ReadQueryRequest,::abd::ReadQueryReply>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_WriteProp : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_WriteProp() {
-      ::grpc::Service::MarkMethodStreamed(2,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::abd::WritePropRequest, ::abd::Ack>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::abd::WritePropRequest, ::abd::Ack>* streamer) {
-                       return this->StreamedWriteProp(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_WriteProp() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status WriteProp(::grpc::ServerContext* /*context*/, const ::abd::WritePropRequest* /*request*/, ::abd::Ack* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedWriteProp(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::abd::WritePropRequest,::abd::Ack>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_AcquireLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_AcquireLock() {
-      ::grpc::Service::MarkMethodStreamed(3,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::abd::AcquireLockRequest, ::abd::AcquireLockReply>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::abd::AcquireLockRequest, ::abd::AcquireLockReply>* streamer) {
-                       return this->StreamedAcquireLock(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_AcquireLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status AcquireLock(::grpc::ServerContext* /*context*/, const ::abd::AcquireLockRequest* /*request*/, ::abd::AcquireLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedAcquireLock(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::abd::AcquireLockRequest,::abd::AcquireLockReply>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_ReleaseLock : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_ReleaseLock() {
-      ::grpc::Service::MarkMethodStreamed(4,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::abd::ReleaseLockRequest, ::abd::ReleaseLockReply>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::abd::ReleaseLockRequest, ::abd::ReleaseLockReply>* streamer) {
-                       return this->StreamedReleaseLock(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_ReleaseLock() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status ReleaseLock(::grpc::ServerContext* /*context*/, const ::abd::ReleaseLockRequest* /*request*/, ::abd::ReleaseLockReply* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedReleaseLock(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::abd::ReleaseLockRequest,::abd::ReleaseLockReply>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_WriteQuery<WithStreamedUnaryMethod_ReadQuery<WithStreamedUnaryMethod_WriteProp<WithStreamedUnaryMethod_AcquireLock<WithStreamedUnaryMethod_ReleaseLock<Service > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_WriteQuery<WithStreamedUnaryMethod_ReadQuery<WithStreamedUnaryMethod_WriteProp<WithStreamedUnaryMethod_AcquireLock<WithStreamedUnaryMethod_ReleaseLock<Service > > > > > StreamedService;
-};
-
-}  // namespace abd
-
-
-#include <grpcpp/ports_undef.inc>
-#endif  // GRPC_abd_2eproto__INCLUDED
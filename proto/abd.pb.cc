@@ -1,3662 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: abd.proto
-// Protobuf C++ Version: 6.31.1
-
-#include "abd.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace abd {
-
-inline constexpr WriteQueryRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
-
-template <typename>
-PROTOBUF_CONSTEXPR WriteQueryRequest::WriteQueryRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(WriteQueryRequest_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct WriteQueryRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR WriteQueryRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~WriteQueryRequestDefaultTypeInternal() {}
-  union {
-    WriteQueryRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQueryRequestDefaultTypeInternal _WriteQueryRequest_default_instance_;
-
-inline constexpr Tag::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        client_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        counter_{::uint64_t{0u}} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR Tag::Tag(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(Tag_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TagDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TagDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TagDefaultTypeInternal() {}
-  union {
-    Tag _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TagDefaultTypeInternal _Tag_default_instance_;
-
-inline constexpr ReleaseLockRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        client_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ReleaseLockRequest::ReleaseLockRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(ReleaseLockRequest_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ReleaseLockRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ReleaseLockRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ReleaseLockRequestDefaultTypeInternal() {}
-  union {
-    ReleaseLockRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReleaseLockRequestDefaultTypeInternal _ReleaseLockRequest_default_instance_;
-
-inline constexpr ReleaseLockReply::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        ok_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ReleaseLockReply::ReleaseLockReply(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(ReleaseLockReply_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ReleaseLockReplyDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ReleaseLockReplyDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ReleaseLockReplyDefaultTypeInternal() {}
-  union {
-    ReleaseLockReply _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReleaseLockReplyDefaultTypeInternal _ReleaseLockReply_default_instance_;
-
-inline constexpr ReadQueryRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ReadQueryRequest::ReadQueryRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(ReadQueryRequest_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ReadQueryRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ReadQueryRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ReadQueryRequestDefaultTypeInternal() {}
-  union {
-    ReadQueryRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadQueryRequestDefaultTypeInternal _ReadQueryRequest_default_instance_;
-
-inline constexpr AcquireLockRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        client_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AcquireLockRequest::AcquireLockRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(AcquireLockRequest_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AcquireLockRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AcquireLockRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AcquireLockRequestDefaultTypeInternal() {}
-  union {
-    AcquireLockRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AcquireLockRequestDefaultTypeInternal _AcquireLockRequest_default_instance_;
-
-inline constexpr AcquireLockReply::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        holder_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        granted_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR AcquireLockReply::AcquireLockReply(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(AcquireLockReply_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AcquireLockReplyDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AcquireLockReplyDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AcquireLockReplyDefaultTypeInternal() {}
-  union {
-    AcquireLockReply _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AcquireLockReplyDefaultTypeInternal _AcquireLockReply_default_instance_;
-
-inline constexpr Ack::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        error_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        ok_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR Ack::Ack(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(Ack_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct AckDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AckDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AckDefaultTypeInternal() {}
-  union {
-    Ack _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AckDefaultTypeInternal _Ack_default_instance_;
-
-inline constexpr WriteQueryReply::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        tag_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR WriteQueryReply::WriteQueryReply(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(WriteQueryReply_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct WriteQueryReplyDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR WriteQueryReplyDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~WriteQueryReplyDefaultTypeInternal() {}
-  union {
-    WriteQueryReply _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQueryReplyDefaultTypeInternal _WriteQueryReply_default_instance_;
-
-inline constexpr WritePropRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        key_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        value_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        tag_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR WritePropRequest::WritePropRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(WritePropRequest_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct WritePropRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR WritePropRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~WritePropRequestDefaultTypeInternal() {}
-  union {
-    WritePropRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WritePropRequestDefaultTypeInternal _WritePropRequest_default_instance_;
-
-inline constexpr ReadQueryReply::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        value_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        tag_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ReadQueryReply::ReadQueryReply(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(ReadQueryReply_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ReadQueryReplyDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ReadQueryReplyDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ReadQueryReplyDefaultTypeInternal() {}
-  union {
-    ReadQueryReply _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadQueryReplyDefaultTypeInternal _ReadQueryReply_default_instance_;
-}  // namespace abd
-static constexpr const ::_pb::EnumDescriptor *PROTOBUF_NONNULL *PROTOBUF_NULLABLE
-    file_level_enum_descriptors_abd_2eproto = nullptr;
-static constexpr const ::_pb::ServiceDescriptor *PROTOBUF_NONNULL *PROTOBUF_NULLABLE
-    file_level_service_descriptors_abd_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_abd_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::Tag, _impl_._has_bits_),
-        5, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::Tag, _impl_.counter_),
-        PROTOBUF_FIELD_OFFSET(::abd::Tag, _impl_.client_id_),
-        1,
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::WriteQueryRequest, _impl_._has_bits_),
-        4, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::WriteQueryRequest, _impl_.key_),
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::WriteQueryReply, _impl_._has_bits_),
-        4, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::WriteQueryReply, _impl_.tag_),
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::ReadQueryRequest, _impl_._has_bits_),
-        4, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::ReadQueryRequest, _impl_.key_),
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::ReadQueryReply, _impl_._has_bits_),
-        5, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::ReadQueryReply, _impl_.tag_),
-        PROTOBUF_FIELD_OFFSET(::abd::ReadQueryReply, _impl_.value_),
-        1,
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::WritePropRequest, _impl_._has_bits_),
-        6, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::WritePropRequest, _impl_.key_),
-        PROTOBUF_FIELD_OFFSET(::abd::WritePropRequest, _impl_.tag_),
-        PROTOBUF_FIELD_OFFSET(::abd::WritePropRequest, _impl_.value_),
-        0,
-        2,
-        1,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::Ack, _impl_._has_bits_),
-        5, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::Ack, _impl_.ok_),
-        PROTOBUF_FIELD_OFFSET(::abd::Ack, _impl_.error_),
-        1,
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::AcquireLockRequest, _impl_._has_bits_),
-        5, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::AcquireLockRequest, _impl_.key_),
-        PROTOBUF_FIELD_OFFSET(::abd::AcquireLockRequest, _impl_.client_id_),
-        0,
-        1,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::AcquireLockReply, _impl_._has_bits_),
-        5, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::AcquireLockReply, _impl_.granted_),
-        PROTOBUF_FIELD_OFFSET(::abd::AcquireLockReply, _impl_.holder_),
-        1,
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::ReleaseLockRequest, _impl_._has_bits_),
-        5, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::ReleaseLockRequest, _impl_.key_),
-        PROTOBUF_FIELD_OFFSET(::abd::ReleaseLockRequest, _impl_.client_id_),
-        0,
-        1,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::abd::ReleaseLockReply, _impl_._has_bits_),
-        4, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::abd::ReleaseLockReply, _impl_.ok_),
-        0,
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, sizeof(::abd::Tag)},
-        {7, sizeof(::abd::WriteQueryRequest)},
-        {12, sizeof(::abd::WriteQueryReply)},
-        {17, sizeof(::abd::ReadQueryRequest)},
-        {22, sizeof(::abd::ReadQueryReply)},
-        {29, sizeof(::abd::WritePropRequest)},
-        {38, sizeof(::abd::Ack)},
-        {45, sizeof(::abd::AcquireLockRequest)},
-        {52, sizeof(::abd::AcquireLockReply)},
-        {59, sizeof(::abd::ReleaseLockRequest)},
-        {66, sizeof(::abd::ReleaseLockReply)},
-};
-static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
-    &::abd::_Tag_default_instance_._instance,
-    &::abd::_WriteQueryRequest_default_instance_._instance,
-    &::abd::_WriteQueryReply_default_instance_._instance,
-    &::abd::_ReadQueryRequest_default_instance_._instance,
-    &::abd::_ReadQueryReply_default_instance_._instance,
-    &::abd::_WritePropRequest_default_instance_._instance,
-    &::abd::_Ack_default_instance_._instance,
-    &::abd::_AcquireLockRequest_default_instance_._instance,
-    &::abd::_AcquireLockReply_default_instance_._instance,
-    &::abd::_ReleaseLockRequest_default_instance_._instance,
-    &::abd::_ReleaseLockReply_default_instance_._instance,
-};
-const char descriptor_table_protodef_abd_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\tabd.proto\022\003abd\")\n\003Tag\022\017\n\007counter\030\001 \001(\004"
-    "\022\021\n\tclient_id\030\002 \001(\t\" \n\021WriteQueryRequest"
-    "\022\013\n\003key\030\001 \001(\t\"(\n\017WriteQueryReply\022\025\n\003tag\030"
-    "\001 \001(\0132\010.abd.Tag\"\037\n\020ReadQueryRequest\022\013\n\003k"
-    "ey\030\001 \001(\t\"6\n\016ReadQueryReply\022\025\n\003tag\030\001 \001(\0132"
-    "\010.abd.Tag\022\r\n\005value\030\002 \001(\014\"E\n\020WritePropReq"
-    "uest\022\013\n\003key\030\001 \001(\t\022\025\n\003tag\030\002 \001(\0132\010.abd.Tag"
-    "\022\r\n\005value\030\003 \001(\014\" \n\003Ack\022\n\n\002ok\030\001 \001(\010\022\r\n\005er"
-    "ror\030\002 \001(\t\"4\n\022AcquireLockRequest\022\013\n\003key\030\001"
-    " \001(\t\022\021\n\tclient_id\030\002 \001(\t\"3\n\020AcquireLockRe"
-    "ply\022\017\n\007granted\030\001 \001(\010\022\016\n\006holder\030\002 \001(\t\"4\n\022"
-    "ReleaseLockRequest\022\013\n\003key\030\001 \001(\t\022\021\n\tclien"
-    "t_id\030\002 \001(\t\"\036\n\020ReleaseLockReply\022\n\n\002ok\030\001 \001"
-    "(\0102\255\002\n\nABDService\022:\n\nWriteQuery\022\026.abd.Wr"
-    "iteQueryRequest\032\024.abd.WriteQueryReply\0227\n"
-    "\tReadQuery\022\025.abd.ReadQueryRequest\032\023.abd."
-    "ReadQueryReply\022,\n\tWriteProp\022\025.abd.WriteP"
-    "ropRequest\032\010.abd.Ack\022=\n\013AcquireLock\022\027.ab"
-    "d.AcquireLockRequest\032\025.abd.AcquireLockRe"
-    "ply\022=\n\013ReleaseLock\022\027.abd.ReleaseLockRequ"
-    "est\032\025.abd.ReleaseLockReplyb\006proto3"
-};
-static ::absl::once_flag descriptor_table_abd_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_abd_2eproto = {
-    false,
-    false,
-    834,
-    descriptor_table_protodef_abd_2eproto,
-    "abd.proto",
-    &descriptor_table_abd_2eproto_once,
-    nullptr,
-    0,
-    11,
-    schemas,
-    file_default_instances,
-    TableStruct_abd_2eproto::offsets,
-    file_level_enum_descriptors_abd_2eproto,
-    file_level_service_descriptors_abd_2eproto,
-};
-namespace abd {
-// ===================================================================
-
-class Tag::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<Tag>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(Tag, _impl_._has_bits_);
-};
-
-Tag::Tag(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, Tag_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.Tag)
-}
-PROTOBUF_NDEBUG_INLINE Tag::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::Tag& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        client_id_(arena, from.client_id_) {}
-
-Tag::Tag(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const Tag& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, Tag_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  Tag* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.counter_ = from._impl_.counter_;
-
-  // @@protoc_insertion_point(copy_constructor:abd.Tag)
-}
-PROTOBUF_NDEBUG_INLINE Tag::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        client_id_(arena) {}
-
-inline void Tag::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.counter_ = {};
-}
-Tag::~Tag() {
-  // @@protoc_insertion_point(destructor:abd.Tag)
-  SharedDtor(*this);
-}
-inline void Tag::SharedDtor(MessageLite& self) {
-  Tag& this_ = static_cast<Tag&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.client_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL Tag::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) Tag(arena);
-}
-constexpr auto Tag::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(Tag),
-                                            alignof(Tag));
-}
-constexpr auto Tag::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_Tag_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &Tag::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<Tag>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &Tag::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<Tag>(), &Tag::ByteSizeLong,
-              &Tag::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(Tag, _impl_._cached_size_),
-          false,
-      },
-      &Tag::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull Tag_class_data_ =
-        Tag::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-Tag::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&Tag_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(Tag_class_data_.tc_table);
-  return Tag_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 25, 2>
-Tag::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(Tag, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    Tag_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::Tag>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string client_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 0, 0, PROTOBUF_FIELD_OFFSET(Tag, _impl_.client_id_)}},
-    // uint64 counter = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(Tag, _impl_.counter_), 1>(),
-     {8, 1, 0, PROTOBUF_FIELD_OFFSET(Tag, _impl_.counter_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // uint64 counter = 1;
-    {PROTOBUF_FIELD_OFFSET(Tag, _impl_.counter_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // string client_id = 2;
-    {PROTOBUF_FIELD_OFFSET(Tag, _impl_.client_id_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\7\0\11\0\0\0\0\0"
-    "abd.Tag"
-    "client_id"
-  }},
-};
-PROTOBUF_NOINLINE void Tag::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.Tag)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    _impl_.client_id_.ClearNonDefaultToEmpty();
-  }
-  _impl_.counter_ = ::uint64_t{0u};
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL Tag::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const Tag& this_ = static_cast<const Tag&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL Tag::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const Tag& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.Tag)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // uint64 counter = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
-    if (this_._internal_counter() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          1, this_._internal_counter(), target);
-    }
-  }
-
-  // string client_id = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (!this_._internal_client_id().empty()) {
-      const ::std::string& _s = this_._internal_client_id();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.Tag.client_id");
-      target = stream->WriteStringMaybeAliased(2, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.Tag)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t Tag::ByteSizeLong(const MessageLite& base) {
-  const Tag& this_ = static_cast<const Tag&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t Tag::ByteSizeLong() const {
-  const Tag& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.Tag)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    // string client_id = 2;
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_client_id().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_client_id());
-      }
-    }
-    // uint64 counter = 1;
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (this_._internal_counter() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_counter());
-      }
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void Tag::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<Tag*>(&to_msg);
-  auto& from = static_cast<const Tag&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.Tag)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!from._internal_client_id().empty()) {
-        _this->_internal_set_client_id(from._internal_client_id());
-      } else {
-        if (_this->_impl_.client_id_.IsDefault()) {
-          _this->_internal_set_client_id("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (from._internal_counter() != 0) {
-        _this->_impl_.counter_ = from._impl_.counter_;
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Tag::CopyFrom(const Tag& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.Tag)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void Tag::InternalSwap(Tag* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.client_id_, &other->_impl_.client_id_, arena);
-  swap(_impl_.counter_, other->_impl_.counter_);
-}
-
-::google::protobuf::Metadata Tag::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class WriteQueryRequest::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<WriteQueryRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(WriteQueryRequest, _impl_._has_bits_);
-};
-
-WriteQueryRequest::WriteQueryRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, WriteQueryRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.WriteQueryRequest)
-}
-PROTOBUF_NDEBUG_INLINE WriteQueryRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::WriteQueryRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        key_(arena, from.key_) {}
-
-WriteQueryRequest::WriteQueryRequest(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const WriteQueryRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, WriteQueryRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  WriteQueryRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:abd.WriteQueryRequest)
-}
-PROTOBUF_NDEBUG_INLINE WriteQueryRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        key_(arena) {}
-
-inline void WriteQueryRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-WriteQueryRequest::~WriteQueryRequest() {
-  // @@protoc_insertion_point(destructor:abd.WriteQueryRequest)
-  SharedDtor(*this);
-}
-inline void WriteQueryRequest::SharedDtor(MessageLite& self) {
-  WriteQueryRequest& this_ = static_cast<WriteQueryRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL WriteQueryRequest::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) WriteQueryRequest(arena);
-}
-constexpr auto WriteQueryRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(WriteQueryRequest),
-                                            alignof(WriteQueryRequest));
-}
-constexpr auto WriteQueryRequest::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_WriteQueryRequest_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &WriteQueryRequest::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<WriteQueryRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &WriteQueryRequest::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<WriteQueryRequest>(), &WriteQueryRequest::ByteSizeLong,
-              &WriteQueryRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(WriteQueryRequest, _impl_._cached_size_),
-          false,
-      },
-      &WriteQueryRequest::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull WriteQueryRequest_class_data_ =
-        WriteQueryRequest::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-WriteQueryRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&WriteQueryRequest_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(WriteQueryRequest_class_data_.tc_table);
-  return WriteQueryRequest_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 33, 2>
-WriteQueryRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(WriteQueryRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    WriteQueryRequest_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::WriteQueryRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string key = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(WriteQueryRequest, _impl_.key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string key = 1;
-    {PROTOBUF_FIELD_OFFSET(WriteQueryRequest, _impl_.key_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\25\3\0\0\0\0\0\0"
-    "abd.WriteQueryRequest"
-    "key"
-  }},
-};
-PROTOBUF_NOINLINE void WriteQueryRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.WriteQueryRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    _impl_.key_.ClearNonDefaultToEmpty();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL WriteQueryRequest::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const WriteQueryRequest& this_ = static_cast<const WriteQueryRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL WriteQueryRequest::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const WriteQueryRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.WriteQueryRequest)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // string key = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (!this_._internal_key().empty()) {
-      const ::std::string& _s = this_._internal_key();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.WriteQueryRequest.key");
-      target = stream->WriteStringMaybeAliased(1, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.WriteQueryRequest)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t WriteQueryRequest::ByteSizeLong(const MessageLite& base) {
-  const WriteQueryRequest& this_ = static_cast<const WriteQueryRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t WriteQueryRequest::ByteSizeLong() const {
-  const WriteQueryRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.WriteQueryRequest)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-   {
-    // string key = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_key().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_key());
-      }
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void WriteQueryRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<WriteQueryRequest*>(&to_msg);
-  auto& from = static_cast<const WriteQueryRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.WriteQueryRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    if (!from._internal_key().empty()) {
-      _this->_internal_set_key(from._internal_key());
-    } else {
-      if (_this->_impl_.key_.IsDefault()) {
-        _this->_internal_set_key("");
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void WriteQueryRequest::CopyFrom(const WriteQueryRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.WriteQueryRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void WriteQueryRequest::InternalSwap(WriteQueryRequest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, &other->_impl_.key_, arena);
-}
-
-::google::protobuf::Metadata WriteQueryRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class WriteQueryReply::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<WriteQueryReply>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(WriteQueryReply, _impl_._has_bits_);
-};
-
-WriteQueryReply::WriteQueryReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, WriteQueryReply_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.WriteQueryReply)
-}
-PROTOBUF_NDEBUG_INLINE WriteQueryReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::WriteQueryReply& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-WriteQueryReply::WriteQueryReply(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const WriteQueryReply& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, WriteQueryReply_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  WriteQueryReply* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.tag_ = ((cached_has_bits & 0x00000001u) != 0)
-                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.tag_)
-                : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:abd.WriteQueryReply)
-}
-PROTOBUF_NDEBUG_INLINE WriteQueryReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0} {}
-
-inline void WriteQueryReply::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.tag_ = {};
-}
-WriteQueryReply::~WriteQueryReply() {
-  // @@protoc_insertion_point(destructor:abd.WriteQueryReply)
-  SharedDtor(*this);
-}
-inline void WriteQueryReply::SharedDtor(MessageLite& self) {
-  WriteQueryReply& this_ = static_cast<WriteQueryReply&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.tag_;
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL WriteQueryReply::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) WriteQueryReply(arena);
-}
-constexpr auto WriteQueryReply::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(WriteQueryReply),
-                                            alignof(WriteQueryReply));
-}
-constexpr auto WriteQueryReply::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_WriteQueryReply_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &WriteQueryReply::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<WriteQueryReply>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &WriteQueryReply::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<WriteQueryReply>(), &WriteQueryReply::ByteSizeLong,
-              &WriteQueryReply::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(WriteQueryReply, _impl_._cached_size_),
-          false,
-      },
-      &WriteQueryReply::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull WriteQueryReply_class_data_ =
-        WriteQueryReply::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-WriteQueryReply::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&WriteQueryReply_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(WriteQueryReply_class_data_.tc_table);
-  return WriteQueryReply_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
-WriteQueryReply::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(WriteQueryReply, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    WriteQueryReply_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::WriteQueryReply>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .abd.Tag tag = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(WriteQueryReply, _impl_.tag_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .abd.Tag tag = 1;
-    {PROTOBUF_FIELD_OFFSET(WriteQueryReply, _impl_.tag_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }},
-  {{
-      {::_pbi::TcParser::GetTable<::abd::Tag>()},
-  }},
-  {{
-  }},
-};
-PROTOBUF_NOINLINE void WriteQueryReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.WriteQueryReply)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    ABSL_DCHECK(_impl_.tag_ != nullptr);
-    _impl_.tag_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL WriteQueryReply::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const WriteQueryReply& this_ = static_cast<const WriteQueryReply&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL WriteQueryReply::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const WriteQueryReply& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.WriteQueryReply)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  cached_has_bits = this_._impl_._has_bits_[0];
-  // .abd.Tag tag = 1;
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, *this_._impl_.tag_, this_._impl_.tag_->GetCachedSize(), target,
-        stream);
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.WriteQueryReply)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t WriteQueryReply::ByteSizeLong(const MessageLite& base) {
-  const WriteQueryReply& this_ = static_cast<const WriteQueryReply&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t WriteQueryReply::ByteSizeLong() const {
-  const WriteQueryReply& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.WriteQueryReply)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-   {
-    // .abd.Tag tag = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.tag_);
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void WriteQueryReply::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<WriteQueryReply*>(&to_msg);
-  auto& from = static_cast<const WriteQueryReply&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.WriteQueryReply)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    ABSL_DCHECK(from._impl_.tag_ != nullptr);
-    if (_this->_impl_.tag_ == nullptr) {
-      _this->_impl_.tag_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.tag_);
-    } else {
-      _this->_impl_.tag_->MergeFrom(*from._impl_.tag_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void WriteQueryReply::CopyFrom(const WriteQueryReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.WriteQueryReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void WriteQueryReply::InternalSwap(WriteQueryReply* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.tag_, other->_impl_.tag_);
-}
-
-::google::protobuf::Metadata WriteQueryReply::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ReadQueryRequest::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<ReadQueryRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ReadQueryRequest, _impl_._has_bits_);
-};
-
-ReadQueryRequest::ReadQueryRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ReadQueryRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.ReadQueryRequest)
-}
-PROTOBUF_NDEBUG_INLINE ReadQueryRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::ReadQueryRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        key_(arena, from.key_) {}
-
-ReadQueryRequest::ReadQueryRequest(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const ReadQueryRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ReadQueryRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ReadQueryRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:abd.ReadQueryRequest)
-}
-PROTOBUF_NDEBUG_INLINE ReadQueryRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        key_(arena) {}
-
-inline void ReadQueryRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-ReadQueryRequest::~ReadQueryRequest() {
-  // @@protoc_insertion_point(destructor:abd.ReadQueryRequest)
-  SharedDtor(*this);
-}
-inline void ReadQueryRequest::SharedDtor(MessageLite& self) {
-  ReadQueryRequest& this_ = static_cast<ReadQueryRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.key_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL ReadQueryRequest::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) ReadQueryRequest(arena);
-}
-constexpr auto ReadQueryRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ReadQueryRequest),
-                                            alignof(ReadQueryRequest));
-}
-constexpr auto ReadQueryRequest::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_ReadQueryRequest_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &ReadQueryRequest::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<ReadQueryRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &ReadQueryRequest::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<ReadQueryRequest>(), &ReadQueryRequest::ByteSizeLong,
-              &ReadQueryRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(ReadQueryRequest, _impl_._cached_size_),
-          false,
-      },
-      &ReadQueryRequest::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull ReadQueryRequest_class_data_ =
-        ReadQueryRequest::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-ReadQueryRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&ReadQueryRequest_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(ReadQueryRequest_class_data_.tc_table);
-  return ReadQueryRequest_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 32, 2>
-ReadQueryRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ReadQueryRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    ReadQueryRequest_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::ReadQueryRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string key = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ReadQueryRequest, _impl_.key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string key = 1;
-    {PROTOBUF_FIELD_OFFSET(ReadQueryRequest, _impl_.key_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\24\3\0\0\0\0\0\0"
-    "abd.ReadQueryRequest"
-    "key"
-  }},
-};
-PROTOBUF_NOINLINE void ReadQueryRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.ReadQueryRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    _impl_.key_.ClearNonDefaultToEmpty();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL ReadQueryRequest::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const ReadQueryRequest& this_ = static_cast<const ReadQueryRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL ReadQueryRequest::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const ReadQueryRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.ReadQueryRequest)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // string key = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (!this_._internal_key().empty()) {
-      const ::std::string& _s = this_._internal_key();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.ReadQueryRequest.key");
-      target = stream->WriteStringMaybeAliased(1, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.ReadQueryRequest)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t ReadQueryRequest::ByteSizeLong(const MessageLite& base) {
-  const ReadQueryRequest& this_ = static_cast<const ReadQueryRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t ReadQueryRequest::ByteSizeLong() const {
-  const ReadQueryRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.ReadQueryRequest)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-   {
-    // string key = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_key().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_key());
-      }
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void ReadQueryRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ReadQueryRequest*>(&to_msg);
-  auto& from = static_cast<const ReadQueryRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.ReadQueryRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    if (!from._internal_key().empty()) {
-      _this->_internal_set_key(from._internal_key());
-    } else {
-      if (_this->_impl_.key_.IsDefault()) {
-        _this->_internal_set_key("");
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ReadQueryRequest::CopyFrom(const ReadQueryRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.ReadQueryRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ReadQueryRequest::InternalSwap(ReadQueryRequest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, &other->_impl_.key_, arena);
-}
-
-::google::protobuf::Metadata ReadQueryRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ReadQueryReply::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<ReadQueryReply>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ReadQueryReply, _impl_._has_bits_);
-};
-
-ReadQueryReply::ReadQueryReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ReadQueryReply_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.ReadQueryReply)
-}
-PROTOBUF_NDEBUG_INLINE ReadQueryReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::ReadQueryReply& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        value_(arena, from.value_) {}
-
-ReadQueryReply::ReadQueryReply(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const ReadQueryReply& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ReadQueryReply_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ReadQueryReply* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.tag_ = ((cached_has_bits & 0x00000002u) != 0)
-                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.tag_)
-                : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:abd.ReadQueryReply)
-}
-PROTOBUF_NDEBUG_INLINE ReadQueryReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        value_(arena) {}
-
-inline void ReadQueryReply::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.tag_ = {};
-}
-ReadQueryReply::~ReadQueryReply() {
-  // @@protoc_insertion_point(destructor:abd.ReadQueryReply)
-  SharedDtor(*this);
-}
-inline void ReadQueryReply::SharedDtor(MessageLite& self) {
-  ReadQueryReply& this_ = static_cast<ReadQueryReply&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.value_.Destroy();
-  delete this_._impl_.tag_;
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL ReadQueryReply::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) ReadQueryReply(arena);
-}
-constexpr auto ReadQueryReply::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ReadQueryReply),
-                                            alignof(ReadQueryReply));
-}
-constexpr auto ReadQueryReply::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_ReadQueryReply_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &ReadQueryReply::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<ReadQueryReply>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &ReadQueryReply::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<ReadQueryReply>(), &ReadQueryReply::ByteSizeLong,
-              &ReadQueryReply::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(ReadQueryReply, _impl_._cached_size_),
-          false,
-      },
-      &ReadQueryReply::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull ReadQueryReply_class_data_ =
-        ReadQueryReply::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-ReadQueryReply::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&ReadQueryReply_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(ReadQueryReply_class_data_.tc_table);
-  return ReadQueryReply_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 0, 2>
-ReadQueryReply::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ReadQueryReply, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    ReadQueryReply_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::ReadQueryReply>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // bytes value = 2;
-    {::_pbi::TcParser::FastBS1,
-     {18, 0, 0, PROTOBUF_FIELD_OFFSET(ReadQueryReply, _impl_.value_)}},
-    // .abd.Tag tag = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 1, 0, PROTOBUF_FIELD_OFFSET(ReadQueryReply, _impl_.tag_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .abd.Tag tag = 1;
-    {PROTOBUF_FIELD_OFFSET(ReadQueryReply, _impl_.tag_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // bytes value = 2;
-    {PROTOBUF_FIELD_OFFSET(ReadQueryReply, _impl_.value_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBytes | ::_fl::kRepAString)},
-  }},
-  {{
-      {::_pbi::TcParser::GetTable<::abd::Tag>()},
-  }},
-  {{
-  }},
-};
-PROTOBUF_NOINLINE void ReadQueryReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.ReadQueryReply)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      _impl_.value_.ClearNonDefaultToEmpty();
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      ABSL_DCHECK(_impl_.tag_ != nullptr);
-      _impl_.tag_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL ReadQueryReply::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const ReadQueryReply& this_ = static_cast<const ReadQueryReply&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL ReadQueryReply::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const ReadQueryReply& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.ReadQueryReply)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  cached_has_bits = this_._impl_._has_bits_[0];
-  // .abd.Tag tag = 1;
-  if ((cached_has_bits & 0x00000002u) != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, *this_._impl_.tag_, this_._impl_.tag_->GetCachedSize(), target,
-        stream);
-  }
-
-  // bytes value = 2;
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    if (!this_._internal_value().empty()) {
-      const ::std::string& _s = this_._internal_value();
-      target = stream->WriteBytesMaybeAliased(2, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.ReadQueryReply)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t ReadQueryReply::ByteSizeLong(const MessageLite& base) {
-  const ReadQueryReply& this_ = static_cast<const ReadQueryReply&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t ReadQueryReply::ByteSizeLong() const {
-  const ReadQueryReply& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.ReadQueryReply)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    // bytes value = 2;
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_value().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::BytesSize(
-                                        this_._internal_value());
-      }
-    }
-    // .abd.Tag tag = 1;
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.tag_);
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void ReadQueryReply::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ReadQueryReply*>(&to_msg);
-  auto& from = static_cast<const ReadQueryReply&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.ReadQueryReply)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!from._internal_value().empty()) {
-        _this->_internal_set_value(from._internal_value());
-      } else {
-        if (_this->_impl_.value_.IsDefault()) {
-          _this->_internal_set_value("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      ABSL_DCHECK(from._impl_.tag_ != nullptr);
-      if (_this->_impl_.tag_ == nullptr) {
-        _this->_impl_.tag_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.tag_);
-      } else {
-        _this->_impl_.tag_->MergeFrom(*from._impl_.tag_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ReadQueryReply::CopyFrom(const ReadQueryReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.ReadQueryReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ReadQueryReply::InternalSwap(ReadQueryReply* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.value_, &other->_impl_.value_, arena);
-  swap(_impl_.tag_, other->_impl_.tag_);
-}
-
-::google::protobuf::Metadata ReadQueryReply::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class WritePropRequest::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<WritePropRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_._has_bits_);
-};
-
-WritePropRequest::WritePropRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, WritePropRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.WritePropRequest)
-}
-PROTOBUF_NDEBUG_INLINE WritePropRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::WritePropRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        key_(arena, from.key_),
-        value_(arena, from.value_) {}
-
-WritePropRequest::WritePropRequest(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const WritePropRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, WritePropRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  WritePropRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.tag_ = ((cached_has_bits & 0x00000004u) != 0)
-                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.tag_)
-                : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:abd.WritePropRequest)
-}
-PROTOBUF_NDEBUG_INLINE WritePropRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        key_(arena),
-        value_(arena) {}
-
-inline void WritePropRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.tag_ = {};
-}
-WritePropRequest::~WritePropRequest() {
-  // @@protoc_insertion_point(destructor:abd.WritePropRequest)
-  SharedDtor(*this);
-}
-inline void WritePropRequest::SharedDtor(MessageLite& self) {
-  WritePropRequest& this_ = static_cast<WritePropRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.key_.Destroy();
-  this_._impl_.value_.Destroy();
-  delete this_._impl_.tag_;
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL WritePropRequest::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) WritePropRequest(arena);
-}
-constexpr auto WritePropRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(WritePropRequest),
-                                            alignof(WritePropRequest));
-}
-constexpr auto WritePropRequest::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_WritePropRequest_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &WritePropRequest::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<WritePropRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &WritePropRequest::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<WritePropRequest>(), &WritePropRequest::ByteSizeLong,
-              &WritePropRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_._cached_size_),
-          false,
-      },
-      &WritePropRequest::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull WritePropRequest_class_data_ =
-        WritePropRequest::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-WritePropRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&WritePropRequest_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(WritePropRequest_class_data_.tc_table);
-  return WritePropRequest_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 32, 2>
-WritePropRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    WritePropRequest_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::WritePropRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string key = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_.key_)}},
-    // .abd.Tag tag = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 2, 0, PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_.tag_)}},
-    // bytes value = 3;
-    {::_pbi::TcParser::FastBS1,
-     {26, 1, 0, PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_.value_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string key = 1;
-    {PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_.key_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // .abd.Tag tag = 2;
-    {PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_.tag_), _Internal::kHasBitsOffset + 2, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // bytes value = 3;
-    {PROTOBUF_FIELD_OFFSET(WritePropRequest, _impl_.value_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBytes | ::_fl::kRepAString)},
-  }},
-  {{
-      {::_pbi::TcParser::GetTable<::abd::Tag>()},
-  }},
-  {{
-    "\24\3\0\0\0\0\0\0"
-    "abd.WritePropRequest"
-    "key"
-  }},
-};
-PROTOBUF_NOINLINE void WritePropRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.WritePropRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000007u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      _impl_.key_.ClearNonDefaultToEmpty();
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      _impl_.value_.ClearNonDefaultToEmpty();
-    }
-    if ((cached_has_bits & 0x00000004u) != 0) {
-      ABSL_DCHECK(_impl_.tag_ != nullptr);
-      _impl_.tag_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL WritePropRequest::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const WritePropRequest& this_ = static_cast<const WritePropRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL WritePropRequest::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const WritePropRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.WritePropRequest)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // string key = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (!this_._internal_key().empty()) {
-      const ::std::string& _s = this_._internal_key();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.WritePropRequest.key");
-      target = stream->WriteStringMaybeAliased(1, _s, target);
-    }
-  }
-
-  cached_has_bits = this_._impl_._has_bits_[0];
-  // .abd.Tag tag = 2;
-  if ((cached_has_bits & 0x00000004u) != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        2, *this_._impl_.tag_, this_._impl_.tag_->GetCachedSize(), target,
-        stream);
-  }
-
-  // bytes value = 3;
-  if ((cached_has_bits & 0x00000002u) != 0) {
-    if (!this_._internal_value().empty()) {
-      const ::std::string& _s = this_._internal_value();
-      target = stream->WriteBytesMaybeAliased(3, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.WritePropRequest)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t WritePropRequest::ByteSizeLong(const MessageLite& base) {
-  const WritePropRequest& this_ = static_cast<const WritePropRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t WritePropRequest::ByteSizeLong() const {
-  const WritePropRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.WritePropRequest)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000007u) != 0) {
-    // string key = 1;
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_key().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_key());
-      }
-    }
-    // bytes value = 3;
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (!this_._internal_value().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::BytesSize(
-                                        this_._internal_value());
-      }
-    }
-    // .abd.Tag tag = 2;
-    if ((cached_has_bits & 0x00000004u) != 0) {
-      total_size += 1 +
-                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.tag_);
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void WritePropRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<WritePropRequest*>(&to_msg);
-  auto& from = static_cast<const WritePropRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.WritePropRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000007u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!from._internal_key().empty()) {
-        _this->_internal_set_key(from._internal_key());
-      } else {
-        if (_this->_impl_.key_.IsDefault()) {
-          _this->_internal_set_key("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (!from._internal_value().empty()) {
-        _this->_internal_set_value(from._internal_value());
-      } else {
-        if (_this->_impl_.value_.IsDefault()) {
-          _this->_internal_set_value("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000004u) != 0) {
-      ABSL_DCHECK(from._impl_.tag_ != nullptr);
-      if (_this->_impl_.tag_ == nullptr) {
-        _this->_impl_.tag_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.tag_);
-      } else {
-        _this->_impl_.tag_->MergeFrom(*from._impl_.tag_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void WritePropRequest::CopyFrom(const WritePropRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.WritePropRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void WritePropRequest::InternalSwap(WritePropRequest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, &other->_impl_.key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.value_, &other->_impl_.value_, arena);
-  swap(_impl_.tag_, other->_impl_.tag_);
-}
-
-::google::protobuf::Metadata WritePropRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class Ack::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<Ack>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(Ack, _impl_._has_bits_);
-};
-
-Ack::Ack(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, Ack_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.Ack)
-}
-PROTOBUF_NDEBUG_INLINE Ack::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::Ack& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        error_(arena, from.error_) {}
-
-Ack::Ack(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const Ack& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, Ack_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  Ack* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.ok_ = from._impl_.ok_;
-
-  // @@protoc_insertion_point(copy_constructor:abd.Ack)
-}
-PROTOBUF_NDEBUG_INLINE Ack::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        error_(arena) {}
-
-inline void Ack::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.ok_ = {};
-}
-Ack::~Ack() {
-  // @@protoc_insertion_point(destructor:abd.Ack)
-  SharedDtor(*this);
-}
-inline void Ack::SharedDtor(MessageLite& self) {
-  Ack& this_ = static_cast<Ack&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.error_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL Ack::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) Ack(arena);
-}
-constexpr auto Ack::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(Ack),
-                                            alignof(Ack));
-}
-constexpr auto Ack::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_Ack_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &Ack::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<Ack>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &Ack::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<Ack>(), &Ack::ByteSizeLong,
-              &Ack::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(Ack, _impl_._cached_size_),
-          false,
-      },
-      &Ack::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull Ack_class_data_ =
-        Ack::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-Ack::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&Ack_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(Ack_class_data_.tc_table);
-  return Ack_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 21, 2>
-Ack::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(Ack, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    Ack_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::Ack>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string error = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 0, 0, PROTOBUF_FIELD_OFFSET(Ack, _impl_.error_)}},
-    // bool ok = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(Ack, _impl_.ok_), 1>(),
-     {8, 1, 0, PROTOBUF_FIELD_OFFSET(Ack, _impl_.ok_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // bool ok = 1;
-    {PROTOBUF_FIELD_OFFSET(Ack, _impl_.ok_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
-    // string error = 2;
-    {PROTOBUF_FIELD_OFFSET(Ack, _impl_.error_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\7\0\5\0\0\0\0\0"
-    "abd.Ack"
-    "error"
-  }},
-};
-PROTOBUF_NOINLINE void Ack::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.Ack)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    _impl_.error_.ClearNonDefaultToEmpty();
-  }
-  _impl_.ok_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL Ack::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const Ack& this_ = static_cast<const Ack&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL Ack::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const Ack& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.Ack)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // bool ok = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
-    if (this_._internal_ok() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteBoolToArray(
-          1, this_._internal_ok(), target);
-    }
-  }
-
-  // string error = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (!this_._internal_error().empty()) {
-      const ::std::string& _s = this_._internal_error();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.Ack.error");
-      target = stream->WriteStringMaybeAliased(2, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.Ack)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t Ack::ByteSizeLong(const MessageLite& base) {
-  const Ack& this_ = static_cast<const Ack&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t Ack::ByteSizeLong() const {
-  const Ack& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.Ack)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    // string error = 2;
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_error().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_error());
-      }
-    }
-    // bool ok = 1;
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (this_._internal_ok() != 0) {
-        total_size += 2;
-      }
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void Ack::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<Ack*>(&to_msg);
-  auto& from = static_cast<const Ack&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.Ack)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!from._internal_error().empty()) {
-        _this->_internal_set_error(from._internal_error());
-      } else {
-        if (_this->_impl_.error_.IsDefault()) {
-          _this->_internal_set_error("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (from._internal_ok() != 0) {
-        _this->_impl_.ok_ = from._impl_.ok_;
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Ack::CopyFrom(const Ack& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.Ack)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void Ack::InternalSwap(Ack* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.error_, &other->_impl_.error_, arena);
-  swap(_impl_.ok_, other->_impl_.ok_);
-}
-
-::google::protobuf::Metadata Ack::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AcquireLockRequest::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<AcquireLockRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(AcquireLockRequest, _impl_._has_bits_);
-};
-
-AcquireLockRequest::AcquireLockRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, AcquireLockRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.AcquireLockRequest)
-}
-PROTOBUF_NDEBUG_INLINE AcquireLockRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::AcquireLockRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        key_(arena, from.key_),
-        client_id_(arena, from.client_id_) {}
-
-AcquireLockRequest::AcquireLockRequest(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const AcquireLockRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, AcquireLockRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AcquireLockRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:abd.AcquireLockRequest)
-}
-PROTOBUF_NDEBUG_INLINE AcquireLockRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        key_(arena),
-        client_id_(arena) {}
-
-inline void AcquireLockRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-AcquireLockRequest::~AcquireLockRequest() {
-  // @@protoc_insertion_point(destructor:abd.AcquireLockRequest)
-  SharedDtor(*this);
-}
-inline void AcquireLockRequest::SharedDtor(MessageLite& self) {
-  AcquireLockRequest& this_ = static_cast<AcquireLockRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.key_.Destroy();
-  this_._impl_.client_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL AcquireLockRequest::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) AcquireLockRequest(arena);
-}
-constexpr auto AcquireLockRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AcquireLockRequest),
-                                            alignof(AcquireLockRequest));
-}
-constexpr auto AcquireLockRequest::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_AcquireLockRequest_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &AcquireLockRequest::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<AcquireLockRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &AcquireLockRequest::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<AcquireLockRequest>(), &AcquireLockRequest::ByteSizeLong,
-              &AcquireLockRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(AcquireLockRequest, _impl_._cached_size_),
-          false,
-      },
-      &AcquireLockRequest::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull AcquireLockRequest_class_data_ =
-        AcquireLockRequest::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-AcquireLockRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&AcquireLockRequest_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(AcquireLockRequest_class_data_.tc_table);
-  return AcquireLockRequest_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 43, 2>
-AcquireLockRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(AcquireLockRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    AcquireLockRequest_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::AcquireLockRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string client_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 1, 0, PROTOBUF_FIELD_OFFSET(AcquireLockRequest, _impl_.client_id_)}},
-    // string key = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(AcquireLockRequest, _impl_.key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string key = 1;
-    {PROTOBUF_FIELD_OFFSET(AcquireLockRequest, _impl_.key_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string client_id = 2;
-    {PROTOBUF_FIELD_OFFSET(AcquireLockRequest, _impl_.client_id_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\3\11\0\0\0\0\0"
-    "abd.AcquireLockRequest"
-    "key"
-    "client_id"
-  }},
-};
-PROTOBUF_NOINLINE void AcquireLockRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.AcquireLockRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      _impl_.key_.ClearNonDefaultToEmpty();
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      _impl_.client_id_.ClearNonDefaultToEmpty();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL AcquireLockRequest::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const AcquireLockRequest& this_ = static_cast<const AcquireLockRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL AcquireLockRequest::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const AcquireLockRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.AcquireLockRequest)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // string key = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (!this_._internal_key().empty()) {
-      const ::std::string& _s = this_._internal_key();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.AcquireLockRequest.key");
-      target = stream->WriteStringMaybeAliased(1, _s, target);
-    }
-  }
-
-  // string client_id = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
-    if (!this_._internal_client_id().empty()) {
-      const ::std::string& _s = this_._internal_client_id();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.AcquireLockRequest.client_id");
-      target = stream->WriteStringMaybeAliased(2, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.AcquireLockRequest)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t AcquireLockRequest::ByteSizeLong(const MessageLite& base) {
-  const AcquireLockRequest& this_ = static_cast<const AcquireLockRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t AcquireLockRequest::ByteSizeLong() const {
-  const AcquireLockRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.AcquireLockRequest)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    // string key = 1;
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_key().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_key());
-      }
-    }
-    // string client_id = 2;
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (!this_._internal_client_id().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_client_id());
-      }
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void AcquireLockRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AcquireLockRequest*>(&to_msg);
-  auto& from = static_cast<const AcquireLockRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.AcquireLockRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!from._internal_key().empty()) {
-        _this->_internal_set_key(from._internal_key());
-      } else {
-        if (_this->_impl_.key_.IsDefault()) {
-          _this->_internal_set_key("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (!from._internal_client_id().empty()) {
-        _this->_internal_set_client_id(from._internal_client_id());
-      } else {
-        if (_this->_impl_.client_id_.IsDefault()) {
-          _this->_internal_set_client_id("");
-        }
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AcquireLockRequest::CopyFrom(const AcquireLockRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.AcquireLockRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AcquireLockRequest::InternalSwap(AcquireLockRequest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, &other->_impl_.key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.client_id_, &other->_impl_.client_id_, arena);
-}
-
-::google::protobuf::Metadata AcquireLockRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class AcquireLockReply::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<AcquireLockReply>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(AcquireLockReply, _impl_._has_bits_);
-};
-
-AcquireLockReply::AcquireLockReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, AcquireLockReply_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.AcquireLockReply)
-}
-PROTOBUF_NDEBUG_INLINE AcquireLockReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::AcquireLockReply& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        holder_(arena, from.holder_) {}
-
-AcquireLockReply::AcquireLockReply(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const AcquireLockReply& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, AcquireLockReply_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  AcquireLockReply* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.granted_ = from._impl_.granted_;
-
-  // @@protoc_insertion_point(copy_constructor:abd.AcquireLockReply)
-}
-PROTOBUF_NDEBUG_INLINE AcquireLockReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        holder_(arena) {}
-
-inline void AcquireLockReply::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.granted_ = {};
-}
-AcquireLockReply::~AcquireLockReply() {
-  // @@protoc_insertion_point(destructor:abd.AcquireLockReply)
-  SharedDtor(*this);
-}
-inline void AcquireLockReply::SharedDtor(MessageLite& self) {
-  AcquireLockReply& this_ = static_cast<AcquireLockReply&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.holder_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL AcquireLockReply::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) AcquireLockReply(arena);
-}
-constexpr auto AcquireLockReply::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AcquireLockReply),
-                                            alignof(AcquireLockReply));
-}
-constexpr auto AcquireLockReply::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_AcquireLockReply_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &AcquireLockReply::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<AcquireLockReply>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &AcquireLockReply::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<AcquireLockReply>(), &AcquireLockReply::ByteSizeLong,
-              &AcquireLockReply::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(AcquireLockReply, _impl_._cached_size_),
-          false,
-      },
-      &AcquireLockReply::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull AcquireLockReply_class_data_ =
-        AcquireLockReply::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-AcquireLockReply::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&AcquireLockReply_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(AcquireLockReply_class_data_.tc_table);
-  return AcquireLockReply_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 35, 2>
-AcquireLockReply::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(AcquireLockReply, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    AcquireLockReply_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::AcquireLockReply>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string holder = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 0, 0, PROTOBUF_FIELD_OFFSET(AcquireLockReply, _impl_.holder_)}},
-    // bool granted = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(AcquireLockReply, _impl_.granted_), 1>(),
-     {8, 1, 0, PROTOBUF_FIELD_OFFSET(AcquireLockReply, _impl_.granted_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // bool granted = 1;
-    {PROTOBUF_FIELD_OFFSET(AcquireLockReply, _impl_.granted_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
-    // string holder = 2;
-    {PROTOBUF_FIELD_OFFSET(AcquireLockReply, _impl_.holder_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\24\0\6\0\0\0\0\0"
-    "abd.AcquireLockReply"
-    "holder"
-  }},
-};
-PROTOBUF_NOINLINE void AcquireLockReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.AcquireLockReply)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    _impl_.holder_.ClearNonDefaultToEmpty();
-  }
-  _impl_.granted_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL AcquireLockReply::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const AcquireLockReply& this_ = static_cast<const AcquireLockReply&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL AcquireLockReply::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const AcquireLockReply& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.AcquireLockReply)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // bool granted = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
-    if (this_._internal_granted() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteBoolToArray(
-          1, this_._internal_granted(), target);
-    }
-  }
-
-  // string holder = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (!this_._internal_holder().empty()) {
-      const ::std::string& _s = this_._internal_holder();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.AcquireLockReply.holder");
-      target = stream->WriteStringMaybeAliased(2, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.AcquireLockReply)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t AcquireLockReply::ByteSizeLong(const MessageLite& base) {
-  const AcquireLockReply& this_ = static_cast<const AcquireLockReply&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t AcquireLockReply::ByteSizeLong() const {
-  const AcquireLockReply& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.AcquireLockReply)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    // string holder = 2;
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_holder().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_holder());
-      }
-    }
-    // bool granted = 1;
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (this_._internal_granted() != 0) {
-        total_size += 2;
-      }
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void AcquireLockReply::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<AcquireLockReply*>(&to_msg);
-  auto& from = static_cast<const AcquireLockReply&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.AcquireLockReply)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!from._internal_holder().empty()) {
-        _this->_internal_set_holder(from._internal_holder());
-      } else {
-        if (_this->_impl_.holder_.IsDefault()) {
-          _this->_internal_set_holder("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (from._internal_granted() != 0) {
-        _this->_impl_.granted_ = from._impl_.granted_;
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void AcquireLockReply::CopyFrom(const AcquireLockReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.AcquireLockReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void AcquireLockReply::InternalSwap(AcquireLockReply* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.holder_, &other->_impl_.holder_, arena);
-  swap(_impl_.granted_, other->_impl_.granted_);
-}
-
-::google::protobuf::Metadata AcquireLockReply::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ReleaseLockRequest::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<ReleaseLockRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ReleaseLockRequest, _impl_._has_bits_);
-};
-
-ReleaseLockRequest::ReleaseLockRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ReleaseLockRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.ReleaseLockRequest)
-}
-PROTOBUF_NDEBUG_INLINE ReleaseLockRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    const ::abd::ReleaseLockRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        key_(arena, from.key_),
-        client_id_(arena, from.client_id_) {}
-
-ReleaseLockRequest::ReleaseLockRequest(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const ReleaseLockRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ReleaseLockRequest_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ReleaseLockRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-
-  // @@protoc_insertion_point(copy_constructor:abd.ReleaseLockRequest)
-}
-PROTOBUF_NDEBUG_INLINE ReleaseLockRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        key_(arena),
-        client_id_(arena) {}
-
-inline void ReleaseLockRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-}
-ReleaseLockRequest::~ReleaseLockRequest() {
-  // @@protoc_insertion_point(destructor:abd.ReleaseLockRequest)
-  SharedDtor(*this);
-}
-inline void ReleaseLockRequest::SharedDtor(MessageLite& self) {
-  ReleaseLockRequest& this_ = static_cast<ReleaseLockRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.key_.Destroy();
-  this_._impl_.client_id_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL ReleaseLockRequest::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) ReleaseLockRequest(arena);
-}
-constexpr auto ReleaseLockRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ReleaseLockRequest),
-                                            alignof(ReleaseLockRequest));
-}
-constexpr auto ReleaseLockRequest::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_ReleaseLockRequest_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &ReleaseLockRequest::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<ReleaseLockRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &ReleaseLockRequest::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<ReleaseLockRequest>(), &ReleaseLockRequest::ByteSizeLong,
-              &ReleaseLockRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(ReleaseLockRequest, _impl_._cached_size_),
-          false,
-      },
-      &ReleaseLockRequest::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull ReleaseLockRequest_class_data_ =
-        ReleaseLockRequest::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-ReleaseLockRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&ReleaseLockRequest_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(ReleaseLockRequest_class_data_.tc_table);
-  return ReleaseLockRequest_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 43, 2>
-ReleaseLockRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ReleaseLockRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    ReleaseLockRequest_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::ReleaseLockRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string client_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 1, 0, PROTOBUF_FIELD_OFFSET(ReleaseLockRequest, _impl_.client_id_)}},
-    // string key = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ReleaseLockRequest, _impl_.key_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string key = 1;
-    {PROTOBUF_FIELD_OFFSET(ReleaseLockRequest, _impl_.key_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string client_id = 2;
-    {PROTOBUF_FIELD_OFFSET(ReleaseLockRequest, _impl_.client_id_), _Internal::kHasBitsOffset + 1, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\3\11\0\0\0\0\0"
-    "abd.ReleaseLockRequest"
-    "key"
-    "client_id"
-  }},
-};
-PROTOBUF_NOINLINE void ReleaseLockRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.ReleaseLockRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      _impl_.key_.ClearNonDefaultToEmpty();
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      _impl_.client_id_.ClearNonDefaultToEmpty();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL ReleaseLockRequest::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const ReleaseLockRequest& this_ = static_cast<const ReleaseLockRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL ReleaseLockRequest::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const ReleaseLockRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.ReleaseLockRequest)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // string key = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (!this_._internal_key().empty()) {
-      const ::std::string& _s = this_._internal_key();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.ReleaseLockRequest.key");
-      target = stream->WriteStringMaybeAliased(1, _s, target);
-    }
-  }
-
-  // string client_id = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
-    if (!this_._internal_client_id().empty()) {
-      const ::std::string& _s = this_._internal_client_id();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "abd.ReleaseLockRequest.client_id");
-      target = stream->WriteStringMaybeAliased(2, _s, target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.ReleaseLockRequest)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t ReleaseLockRequest::ByteSizeLong(const MessageLite& base) {
-  const ReleaseLockRequest& this_ = static_cast<const ReleaseLockRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t ReleaseLockRequest::ByteSizeLong() const {
-  const ReleaseLockRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.ReleaseLockRequest)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    // string key = 1;
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!this_._internal_key().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_key());
-      }
-    }
-    // string client_id = 2;
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (!this_._internal_client_id().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_client_id());
-      }
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void ReleaseLockRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ReleaseLockRequest*>(&to_msg);
-  auto& from = static_cast<const ReleaseLockRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.ReleaseLockRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (!from._internal_key().empty()) {
-        _this->_internal_set_key(from._internal_key());
-      } else {
-        if (_this->_impl_.key_.IsDefault()) {
-          _this->_internal_set_key("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002u) != 0) {
-      if (!from._internal_client_id().empty()) {
-        _this->_internal_set_client_id(from._internal_client_id());
-      } else {
-        if (_this->_impl_.client_id_.IsDefault()) {
-          _this->_internal_set_client_id("");
-        }
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ReleaseLockRequest::CopyFrom(const ReleaseLockRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.ReleaseLockRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ReleaseLockRequest::InternalSwap(ReleaseLockRequest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.key_, &other->_impl_.key_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.client_id_, &other->_impl_.client_id_, arena);
-}
-
-::google::protobuf::Metadata ReleaseLockRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ReleaseLockReply::_Internal {
- public:
-  using HasBits =
-      decltype(::std::declval<ReleaseLockReply>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ReleaseLockReply, _impl_._has_bits_);
-};
-
-ReleaseLockReply::ReleaseLockReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ReleaseLockReply_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:abd.ReleaseLockReply)
-}
-ReleaseLockReply::ReleaseLockReply(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReleaseLockReply& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, ReleaseLockReply_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(from._impl_) {
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-}
-PROTOBUF_NDEBUG_INLINE ReleaseLockReply::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0} {}
-
-inline void ReleaseLockReply::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.ok_ = {};
-}
-ReleaseLockReply::~ReleaseLockReply() {
-  // @@protoc_insertion_point(destructor:abd.ReleaseLockReply)
-  SharedDtor(*this);
-}
-inline void ReleaseLockReply::SharedDtor(MessageLite& self) {
-  ReleaseLockReply& this_ = static_cast<ReleaseLockReply&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL ReleaseLockReply::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) ReleaseLockReply(arena);
-}
-constexpr auto ReleaseLockReply::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(ReleaseLockReply),
-                                            alignof(ReleaseLockReply));
-}
-constexpr auto ReleaseLockReply::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_ReleaseLockReply_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &ReleaseLockReply::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<ReleaseLockReply>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &ReleaseLockReply::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<ReleaseLockReply>(), &ReleaseLockReply::ByteSizeLong,
-              &ReleaseLockReply::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(ReleaseLockReply, _impl_._cached_size_),
-          false,
-      },
-      &ReleaseLockReply::kDescriptorMethods,
-      &descriptor_table_abd_2eproto,
-      nullptr,  // tracker
-  };
-}
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull ReleaseLockReply_class_data_ =
-        ReleaseLockReply::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-ReleaseLockReply::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&ReleaseLockReply_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(ReleaseLockReply_class_data_.tc_table);
-  return ReleaseLockReply_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2>
-ReleaseLockReply::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ReleaseLockReply, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    ReleaseLockReply_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::abd::ReleaseLockReply>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // bool ok = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ReleaseLockReply, _impl_.ok_), 0>(),
-     {8, 0, 0, PROTOBUF_FIELD_OFFSET(ReleaseLockReply, _impl_.ok_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // bool ok = 1;
-    {PROTOBUF_FIELD_OFFSET(ReleaseLockReply, _impl_.ok_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-PROTOBUF_NOINLINE void ReleaseLockReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:abd.ReleaseLockReply)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.ok_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL ReleaseLockReply::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const ReleaseLockReply& this_ = static_cast<const ReleaseLockReply&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL ReleaseLockReply::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const ReleaseLockReply& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(serialize_to_array_start:abd.ReleaseLockReply)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
-
-  // bool ok = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    if (this_._internal_ok() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteBoolToArray(
-          1, this_._internal_ok(), target);
-    }
-  }
-
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:abd.ReleaseLockReply)
-  return target;
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t ReleaseLockReply::ByteSizeLong(const MessageLite& base) {
-  const ReleaseLockReply& this_ = static_cast<const ReleaseLockReply&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t ReleaseLockReply::ByteSizeLong() const {
-  const ReleaseLockReply& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:abd.ReleaseLockReply)
-  ::size_t total_size = 0;
-
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-   {
-    // bool ok = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
-    if ((cached_has_bits & 0x00000001u) != 0) {
-      if (this_._internal_ok() != 0) {
-        total_size += 2;
-      }
-    }
-  }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
-}
-
-void ReleaseLockReply::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ReleaseLockReply*>(&to_msg);
-  auto& from = static_cast<const ReleaseLockReply&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:abd.ReleaseLockReply)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    if (from._internal_ok() != 0) {
-      _this->_impl_.ok_ = from._impl_.ok_;
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ReleaseLockReply::CopyFrom(const ReleaseLockReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:abd.ReleaseLockReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ReleaseLockReply::InternalSwap(ReleaseLockReply* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.ok_, other->_impl_.ok_);
-}
-
-::google::protobuf::Metadata ReleaseLockReply::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace abd
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ [[maybe_unused]] =
-        (::_pbi::AddDescriptors(&descriptor_table_abd_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
@@ -1,3622 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: abd.proto
-// Protobuf C++ Version: 6.31.1
-
-#ifndef abd_2eproto_2epb_2eh
-#define abd_2eproto_2epb_2eh
-
-#include <limits>
-#include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/runtime_version.h"
-#if PROTOBUF_VERSION != 6031001
-#error "Protobuf C++ gencode is built with an incompatible version of"
-#error "Protobuf C++ headers/runtime. See"
-#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
-#endif
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/message_lite.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-
-#define PROTOBUF_INTERNAL_EXPORT_abd_2eproto
-
-namespace google {
-namespace protobuf {
-namespace internal {
-template <typename T>
-::absl::string_view GetAnyMessageName();
-}  // namespace internal
-}  // namespace protobuf
-}  // namespace google
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_abd_2eproto {
-  static const ::uint32_t offsets[];
-};
-extern "C" {
-extern const ::google::protobuf::internal::DescriptorTable descriptor_table_abd_2eproto;
-}  // extern "C"
-namespace abd {
-class Ack;
-struct AckDefaultTypeInternal;
-extern AckDefaultTypeInternal _Ack_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull Ack_class_data_;
-class AcquireLockReply;
-struct AcquireLockReplyDefaultTypeInternal;
-extern AcquireLockReplyDefaultTypeInternal _AcquireLockReply_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull AcquireLockReply_class_data_;
-class AcquireLockRequest;
-struct AcquireLockRequestDefaultTypeInternal;
-extern AcquireLockRequestDefaultTypeInternal _AcquireLockRequest_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull AcquireLockRequest_class_data_;
-class ReadQueryReply;
-struct ReadQueryReplyDefaultTypeInternal;
-extern ReadQueryReplyDefaultTypeInternal _ReadQueryReply_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull ReadQueryReply_class_data_;
-class ReadQueryRequest;
-struct ReadQueryRequestDefaultTypeInternal;
-extern ReadQueryRequestDefaultTypeInternal _ReadQueryRequest_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull ReadQueryRequest_class_data_;
-class ReleaseLockReply;
-struct ReleaseLockReplyDefaultTypeInternal;
-extern ReleaseLockReplyDefaultTypeInternal _ReleaseLockReply_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull ReleaseLockReply_class_data_;
-class ReleaseLockRequest;
-struct ReleaseLockRequestDefaultTypeInternal;
-extern ReleaseLockRequestDefaultTypeInternal _ReleaseLockRequest_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull ReleaseLockRequest_class_data_;
-class Tag;
-struct TagDefaultTypeInternal;
-extern TagDefaultTypeInternal _Tag_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull Tag_class_data_;
-class WritePropRequest;
-struct WritePropRequestDefaultTypeInternal;
-extern WritePropRequestDefaultTypeInternal _WritePropRequest_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull WritePropRequest_class_data_;
-class WriteQueryReply;
-struct WriteQueryReplyDefaultTypeInternal;
-extern WriteQueryReplyDefaultTypeInternal _WriteQueryReply_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull WriteQueryReply_class_data_;
-class WriteQueryRequest;
-struct WriteQueryRequestDefaultTypeInternal;
-extern WriteQueryRequestDefaultTypeInternal _WriteQueryRequest_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull WriteQueryRequest_class_data_;
-}  // namespace abd
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-
-namespace abd {
-
-// ===================================================================
-
-
-// -------------------------------------------------------------------
-
-class WriteQueryRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.WriteQueryRequest) */ {
- public:
-  inline WriteQueryRequest() : WriteQueryRequest(nullptr) {}
-  ~WriteQueryRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(WriteQueryRequest* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(WriteQueryRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR WriteQueryRequest(::google::protobuf::internal::ConstantInitialized);
-
-  inline WriteQueryRequest(const WriteQueryRequest& from) : WriteQueryRequest(nullptr, from) {}
-  inline WriteQueryRequest(WriteQueryRequest&& from) noexcept
-      : WriteQueryRequest(nullptr, ::std::move(from)) {}
-  inline WriteQueryRequest& operator=(const WriteQueryRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline WriteQueryRequest& operator=(WriteQueryRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const WriteQueryRequest& default_instance() {
-    return *reinterpret_cast<const WriteQueryRequest*>(
-        &_WriteQueryRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(WriteQueryRequest& a, WriteQueryRequest& b) { a.Swap(&b); }
-  inline void Swap(WriteQueryRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(WriteQueryRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  WriteQueryRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<WriteQueryRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const WriteQueryRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const WriteQueryRequest& from) { WriteQueryRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(WriteQueryRequest* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.WriteQueryRequest"; }
-
- protected:
-  explicit WriteQueryRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  WriteQueryRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const WriteQueryRequest& from);
-  WriteQueryRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, WriteQueryRequest&& from) noexcept
-      : WriteQueryRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kKeyFieldNumber = 1,
-  };
-  // string key = 1;
-  void clear_key() ;
-  const ::std::string& key() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_key(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_key();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_key();
-  void set_allocated_key(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_key() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_key(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.WriteQueryRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   0, 33,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const WriteQueryRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr key_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull WriteQueryRequest_class_data_;
-// -------------------------------------------------------------------
-
-class Tag final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.Tag) */ {
- public:
-  inline Tag() : Tag(nullptr) {}
-  ~Tag() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(Tag* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(Tag));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR Tag(::google::protobuf::internal::ConstantInitialized);
-
-  inline Tag(const Tag& from) : Tag(nullptr, from) {}
-  inline Tag(Tag&& from) noexcept
-      : Tag(nullptr, ::std::move(from)) {}
-  inline Tag& operator=(const Tag& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Tag& operator=(Tag&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Tag& default_instance() {
-    return *reinterpret_cast<const Tag*>(
-        &_Tag_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(Tag& a, Tag& b) { a.Swap(&b); }
-  inline void Swap(Tag* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Tag* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  Tag* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<Tag>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const Tag& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const Tag& from) { Tag::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(Tag* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.Tag"; }
-
- protected:
-  explicit Tag(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  Tag(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Tag& from);
-  Tag(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, Tag&& from) noexcept
-      : Tag(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kClientIdFieldNumber = 2,
-    kCounterFieldNumber = 1,
-  };
-  // string client_id = 2;
-  void clear_client_id() ;
-  const ::std::string& client_id() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_client_id(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_client_id();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_client_id();
-  void set_allocated_client_id(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_client_id() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_client_id(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_client_id();
-
-  public:
-  // uint64 counter = 1;
-  void clear_counter() ;
-  ::uint64_t counter() const;
-  void set_counter(::uint64_t value);
-
-  private:
-  ::uint64_t _internal_counter() const;
-  void _internal_set_counter(::uint64_t value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.Tag)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   0, 25,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const Tag& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr client_id_;
-    ::uint64_t counter_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull Tag_class_data_;
-// -------------------------------------------------------------------
-
-class ReleaseLockRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.ReleaseLockRequest) */ {
- public:
-  inline ReleaseLockRequest() : ReleaseLockRequest(nullptr) {}
-  ~ReleaseLockRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ReleaseLockRequest* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReleaseLockRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ReleaseLockRequest(::google::protobuf::internal::ConstantInitialized);
-
-  inline ReleaseLockRequest(const ReleaseLockRequest& from) : ReleaseLockRequest(nullptr, from) {}
-  inline ReleaseLockRequest(ReleaseLockRequest&& from) noexcept
-      : ReleaseLockRequest(nullptr, ::std::move(from)) {}
-  inline ReleaseLockRequest& operator=(const ReleaseLockRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ReleaseLockRequest& operator=(ReleaseLockRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ReleaseLockRequest& default_instance() {
-    return *reinterpret_cast<const ReleaseLockRequest*>(
-        &_ReleaseLockRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 9;
-  friend void swap(ReleaseLockRequest& a, ReleaseLockRequest& b) { a.Swap(&b); }
-  inline void Swap(ReleaseLockRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ReleaseLockRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ReleaseLockRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ReleaseLockRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ReleaseLockRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ReleaseLockRequest& from) { ReleaseLockRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ReleaseLockRequest* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.ReleaseLockRequest"; }
-
- protected:
-  explicit ReleaseLockRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ReleaseLockRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReleaseLockRequest& from);
-  ReleaseLockRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReleaseLockRequest&& from) noexcept
-      : ReleaseLockRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kKeyFieldNumber = 1,
-    kClientIdFieldNumber = 2,
-  };
-  // string key = 1;
-  void clear_key() ;
-  const ::std::string& key() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_key(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_key();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_key();
-  void set_allocated_key(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_key() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_key(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_key();
-
-  public:
-  // string client_id = 2;
-  void clear_client_id() ;
-  const ::std::string& client_id() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_client_id(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_client_id();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_client_id();
-  void set_allocated_client_id(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_client_id() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_client_id(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_client_id();
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.ReleaseLockRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   0, 43,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ReleaseLockRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr key_;
-    ::google::protobuf::internal::ArenaStringPtr client_id_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull ReleaseLockRequest_class_data_;
-// -------------------------------------------------------------------
-
-class ReleaseLockReply final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.ReleaseLockReply) */ {
- public:
-  inline ReleaseLockReply() : ReleaseLockReply(nullptr) {}
-  ~ReleaseLockReply() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ReleaseLockReply* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReleaseLockReply));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ReleaseLockReply(::google::protobuf::internal::ConstantInitialized);
-
-  inline ReleaseLockReply(const ReleaseLockReply& from) : ReleaseLockReply(nullptr, from) {}
-  inline ReleaseLockReply(ReleaseLockReply&& from) noexcept
-      : ReleaseLockReply(nullptr, ::std::move(from)) {}
-  inline ReleaseLockReply& operator=(const ReleaseLockReply& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ReleaseLockReply& operator=(ReleaseLockReply&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ReleaseLockReply& default_instance() {
-    return *reinterpret_cast<const ReleaseLockReply*>(
-        &_ReleaseLockReply_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 10;
-  friend void swap(ReleaseLockReply& a, ReleaseLockReply& b) { a.Swap(&b); }
-  inline void Swap(ReleaseLockReply* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ReleaseLockReply* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ReleaseLockReply* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ReleaseLockReply>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ReleaseLockReply& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ReleaseLockReply& from) { ReleaseLockReply::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ReleaseLockReply* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.ReleaseLockReply"; }
-
- protected:
-  explicit ReleaseLockReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ReleaseLockReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReleaseLockReply& from);
-  ReleaseLockReply(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReleaseLockReply&& from) noexcept
-      : ReleaseLockReply(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kOkFieldNumber = 1,
-  };
-  // bool ok = 1;
-  void clear_ok() ;
-  bool ok() const;
-  void set_ok(bool value);
-
-  private:
-  bool _internal_ok() const;
-  void _internal_set_ok(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.ReleaseLockReply)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   0, 0,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ReleaseLockReply& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    bool ok_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull ReleaseLockReply_class_data_;
-// -------------------------------------------------------------------
-
-class ReadQueryRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.ReadQueryRequest) */ {
- public:
-  inline ReadQueryRequest() : ReadQueryRequest(nullptr) {}
-  ~ReadQueryRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ReadQueryRequest* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReadQueryRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ReadQueryRequest(::google::protobuf::internal::ConstantInitialized);
-
-  inline ReadQueryRequest(const ReadQueryRequest& from) : ReadQueryRequest(nullptr, from) {}
-  inline ReadQueryRequest(ReadQueryRequest&& from) noexcept
-      : ReadQueryRequest(nullptr, ::std::move(from)) {}
-  inline ReadQueryRequest& operator=(const ReadQueryRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ReadQueryRequest& operator=(ReadQueryRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ReadQueryRequest& default_instance() {
-    return *reinterpret_cast<const ReadQueryRequest*>(
-        &_ReadQueryRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 3;
-  friend void swap(ReadQueryRequest& a, ReadQueryRequest& b) { a.Swap(&b); }
-  inline void Swap(ReadQueryRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ReadQueryRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ReadQueryRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ReadQueryRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ReadQueryRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ReadQueryRequest& from) { ReadQueryRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ReadQueryRequest* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.ReadQueryRequest"; }
-
- protected:
-  explicit ReadQueryRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ReadQueryRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReadQueryRequest& from);
-  ReadQueryRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReadQueryRequest&& from) noexcept
-      : ReadQueryRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kKeyFieldNumber = 1,
-  };
-  // string key = 1;
-  void clear_key() ;
-  const ::std::string& key() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_key(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_key();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_key();
-  void set_allocated_key(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_key() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_key(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_key();
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.ReadQueryRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   0, 32,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ReadQueryRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr key_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull ReadQueryRequest_class_data_;
-// -------------------------------------------------------------------
-
-class AcquireLockRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.AcquireLockRequest) */ {
- public:
-  inline AcquireLockRequest() : AcquireLockRequest(nullptr) {}
-  ~AcquireLockRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AcquireLockRequest* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AcquireLockRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AcquireLockRequest(::google::protobuf::internal::ConstantInitialized);
-
-  inline AcquireLockRequest(const AcquireLockRequest& from) : AcquireLockRequest(nullptr, from) {}
-  inline AcquireLockRequest(AcquireLockRequest&& from) noexcept
-      : AcquireLockRequest(nullptr, ::std::move(from)) {}
-  inline AcquireLockRequest& operator=(const AcquireLockRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline AcquireLockRequest& operator=(AcquireLockRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const AcquireLockRequest& default_instance() {
-    return *reinterpret_cast<const AcquireLockRequest*>(
-        &_AcquireLockRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 7;
-  friend void swap(AcquireLockRequest& a, AcquireLockRequest& b) { a.Swap(&b); }
-  inline void Swap(AcquireLockRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(AcquireLockRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  AcquireLockRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AcquireLockRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AcquireLockRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AcquireLockRequest& from) { AcquireLockRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(AcquireLockRequest* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.AcquireLockRequest"; }
-
- protected:
-  explicit AcquireLockRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  AcquireLockRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const AcquireLockRequest& from);
-  AcquireLockRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, AcquireLockRequest&& from) noexcept
-      : AcquireLockRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kKeyFieldNumber = 1,
-    kClientIdFieldNumber = 2,
-  };
-  // string key = 1;
-  void clear_key() ;
-  const ::std::string& key() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_key(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_key();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_key();
-  void set_allocated_key(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_key() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_key(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_key();
-
-  public:
-  // string client_id = 2;
-  void clear_client_id() ;
-  const ::std::string& client_id() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_client_id(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_client_id();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_client_id();
-  void set_allocated_client_id(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_client_id() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_client_id(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_client_id();
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.AcquireLockRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   0, 43,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const AcquireLockRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr key_;
-    ::google::protobuf::internal::ArenaStringPtr client_id_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull AcquireLockRequest_class_data_;
-// -------------------------------------------------------------------
-
-class AcquireLockReply final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.AcquireLockReply) */ {
- public:
-  inline AcquireLockReply() : AcquireLockReply(nullptr) {}
-  ~AcquireLockReply() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AcquireLockReply* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AcquireLockReply));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AcquireLockReply(::google::protobuf::internal::ConstantInitialized);
-
-  inline AcquireLockReply(const AcquireLockReply& from) : AcquireLockReply(nullptr, from) {}
-  inline AcquireLockReply(AcquireLockReply&& from) noexcept
-      : AcquireLockReply(nullptr, ::std::move(from)) {}
-  inline AcquireLockReply& operator=(const AcquireLockReply& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline AcquireLockReply& operator=(AcquireLockReply&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const AcquireLockReply& default_instance() {
-    return *reinterpret_cast<const AcquireLockReply*>(
-        &_AcquireLockReply_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 8;
-  friend void swap(AcquireLockReply& a, AcquireLockReply& b) { a.Swap(&b); }
-  inline void Swap(AcquireLockReply* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(AcquireLockReply* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  AcquireLockReply* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AcquireLockReply>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AcquireLockReply& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AcquireLockReply& from) { AcquireLockReply::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(AcquireLockReply* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.AcquireLockReply"; }
-
- protected:
-  explicit AcquireLockReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  AcquireLockReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const AcquireLockReply& from);
-  AcquireLockReply(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, AcquireLockReply&& from) noexcept
-      : AcquireLockReply(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kHolderFieldNumber = 2,
-    kGrantedFieldNumber = 1,
-  };
-  // string holder = 2;
-  void clear_holder() ;
-  const ::std::string& holder() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_holder(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_holder();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_holder();
-  void set_allocated_holder(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_holder() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_holder(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_holder();
-
-  public:
-  // bool granted = 1;
-  void clear_granted() ;
-  bool granted() const;
-  void set_granted(bool value);
-
-  private:
-  bool _internal_granted() const;
-  void _internal_set_granted(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.AcquireLockReply)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   0, 35,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const AcquireLockReply& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr holder_;
-    bool granted_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull AcquireLockReply_class_data_;
-// -------------------------------------------------------------------
-
-class Ack final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.Ack) */ {
- public:
-  inline Ack() : Ack(nullptr) {}
-  ~Ack() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(Ack* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(Ack));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR Ack(::google::protobuf::internal::ConstantInitialized);
-
-  inline Ack(const Ack& from) : Ack(nullptr, from) {}
-  inline Ack(Ack&& from) noexcept
-      : Ack(nullptr, ::std::move(from)) {}
-  inline Ack& operator=(const Ack& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Ack& operator=(Ack&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Ack& default_instance() {
-    return *reinterpret_cast<const Ack*>(
-        &_Ack_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 6;
-  friend void swap(Ack& a, Ack& b) { a.Swap(&b); }
-  inline void Swap(Ack* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Ack* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  Ack* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<Ack>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const Ack& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const Ack& from) { Ack::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(Ack* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.Ack"; }
-
- protected:
-  explicit Ack(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  Ack(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Ack& from);
-  Ack(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, Ack&& from) noexcept
-      : Ack(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kErrorFieldNumber = 2,
-    kOkFieldNumber = 1,
-  };
-  // string error = 2;
-  void clear_error() ;
-  const ::std::string& error() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_error(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_error();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_error();
-  void set_allocated_error(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_error() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_error(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_error();
-
-  public:
-  // bool ok = 1;
-  void clear_ok() ;
-  bool ok() const;
-  void set_ok(bool value);
-
-  private:
-  bool _internal_ok() const;
-  void _internal_set_ok(bool value);
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.Ack)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   0, 21,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const Ack& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr error_;
-    bool ok_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull Ack_class_data_;
-// -------------------------------------------------------------------
-
-class WriteQueryReply final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.WriteQueryReply) */ {
- public:
-  inline WriteQueryReply() : WriteQueryReply(nullptr) {}
-  ~WriteQueryReply() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(WriteQueryReply* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(WriteQueryReply));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR WriteQueryReply(::google::protobuf::internal::ConstantInitialized);
-
-  inline WriteQueryReply(const WriteQueryReply& from) : WriteQueryReply(nullptr, from) {}
-  inline WriteQueryReply(WriteQueryReply&& from) noexcept
-      : WriteQueryReply(nullptr, ::std::move(from)) {}
-  inline WriteQueryReply& operator=(const WriteQueryReply& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline WriteQueryReply& operator=(WriteQueryReply&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const WriteQueryReply& default_instance() {
-    return *reinterpret_cast<const WriteQueryReply*>(
-        &_WriteQueryReply_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(WriteQueryReply& a, WriteQueryReply& b) { a.Swap(&b); }
-  inline void Swap(WriteQueryReply* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(WriteQueryReply* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  WriteQueryReply* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<WriteQueryReply>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const WriteQueryReply& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const WriteQueryReply& from) { WriteQueryReply::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(WriteQueryReply* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.WriteQueryReply"; }
-
- protected:
-  explicit WriteQueryReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  WriteQueryReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const WriteQueryReply& from);
-  WriteQueryReply(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, WriteQueryReply&& from) noexcept
-      : WriteQueryReply(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kTagFieldNumber = 1,
-  };
-  // .abd.Tag tag = 1;
-  bool has_tag() const;
-  void clear_tag() ;
-  const ::abd::Tag& tag() const;
-  [[nodiscard]] ::abd::Tag* PROTOBUF_NULLABLE release_tag();
-  ::abd::Tag* PROTOBUF_NONNULL mutable_tag();
-  void set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value);
-  ::abd::Tag* PROTOBUF_NULLABLE unsafe_arena_release_tag();
-
-  private:
-  const ::abd::Tag& _internal_tag() const;
-  ::abd::Tag* PROTOBUF_NONNULL _internal_mutable_tag();
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.WriteQueryReply)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   1, 0,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const WriteQueryReply& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::abd::Tag* PROTOBUF_NULLABLE tag_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull WriteQueryReply_class_data_;
-// -------------------------------------------------------------------
-
-class WritePropRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.WritePropRequest) */ {
- public:
-  inline WritePropRequest() : WritePropRequest(nullptr) {}
-  ~WritePropRequest() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(WritePropRequest* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(WritePropRequest));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR WritePropRequest(::google::protobuf::internal::ConstantInitialized);
-
-  inline WritePropRequest(const WritePropRequest& from) : WritePropRequest(nullptr, from) {}
-  inline WritePropRequest(WritePropRequest&& from) noexcept
-      : WritePropRequest(nullptr, ::std::move(from)) {}
-  inline WritePropRequest& operator=(const WritePropRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline WritePropRequest& operator=(WritePropRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const WritePropRequest& default_instance() {
-    return *reinterpret_cast<const WritePropRequest*>(
-        &_WritePropRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 5;
-  friend void swap(WritePropRequest& a, WritePropRequest& b) { a.Swap(&b); }
-  inline void Swap(WritePropRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(WritePropRequest* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  WritePropRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<WritePropRequest>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const WritePropRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const WritePropRequest& from) { WritePropRequest::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(WritePropRequest* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.WritePropRequest"; }
-
- protected:
-  explicit WritePropRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  WritePropRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const WritePropRequest& from);
-  WritePropRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, WritePropRequest&& from) noexcept
-      : WritePropRequest(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kKeyFieldNumber = 1,
-    kValueFieldNumber = 3,
-    kTagFieldNumber = 2,
-  };
-  // string key = 1;
-  void clear_key() ;
-  const ::std::string& key() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_key(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_key();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_key();
-  void set_allocated_key(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_key() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_key(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_key();
-
-  public:
-  // bytes value = 3;
-  void clear_value() ;
-  const ::std::string& value() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_value(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_value();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_value();
-  void set_allocated_value(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_value() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_value(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_value();
-
-  public:
-  // .abd.Tag tag = 2;
-  bool has_tag() const;
-  void clear_tag() ;
-  const ::abd::Tag& tag() const;
-  [[nodiscard]] ::abd::Tag* PROTOBUF_NULLABLE release_tag();
-  ::abd::Tag* PROTOBUF_NONNULL mutable_tag();
-  void set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value);
-  ::abd::Tag* PROTOBUF_NULLABLE unsafe_arena_release_tag();
-
-  private:
-  const ::abd::Tag& _internal_tag() const;
-  ::abd::Tag* PROTOBUF_NONNULL _internal_mutable_tag();
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.WritePropRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<2, 3,
-                                   1, 32,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const WritePropRequest& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr key_;
-    ::google::protobuf::internal::ArenaStringPtr value_;
-    ::abd::Tag* PROTOBUF_NULLABLE tag_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull WritePropRequest_class_data_;
-// -------------------------------------------------------------------
-
-class ReadQueryReply final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:abd.ReadQueryReply) */ {
- public:
-  inline ReadQueryReply() : ReadQueryReply(nullptr) {}
-  ~ReadQueryReply() PROTOBUF_FINAL;
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ReadQueryReply* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReadQueryReply));
-  }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ReadQueryReply(::google::protobuf::internal::ConstantInitialized);
-
-  inline ReadQueryReply(const ReadQueryReply& from) : ReadQueryReply(nullptr, from) {}
-  inline ReadQueryReply(ReadQueryReply&& from) noexcept
-      : ReadQueryReply(nullptr, ::std::move(from)) {}
-  inline ReadQueryReply& operator=(const ReadQueryReply& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ReadQueryReply& operator=(ReadQueryReply&& from) noexcept {
-    if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
-    return GetDescriptor();
-  }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const ReadQueryReply& default_instance() {
-    return *reinterpret_cast<const ReadQueryReply*>(
-        &_ReadQueryReply_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(ReadQueryReply& a, ReadQueryReply& b) { a.Swap(&b); }
-  inline void Swap(ReadQueryReply* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
-      InternalSwap(other);
-    } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ReadQueryReply* PROTOBUF_NONNULL other) {
-    if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  ReadQueryReply* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ReadQueryReply>(arena);
-  }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ReadQueryReply& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ReadQueryReply& from) { ReadQueryReply::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
-  }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
-  private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
-  public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(ReadQueryReply* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "abd.ReadQueryReply"; }
-
- protected:
-  explicit ReadQueryReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ReadQueryReply(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReadQueryReply& from);
-  ReadQueryReply(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReadQueryReply&& from) noexcept
-      : ReadQueryReply(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kValueFieldNumber = 2,
-    kTagFieldNumber = 1,
-  };
-  // bytes value = 2;
-  void clear_value() ;
-  const ::std::string& value() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_value(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_value();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_value();
-  void set_allocated_value(::std::string* PROTOBUF_NULLABLE value);
-
-  private:
-  const ::std::string& _internal_value() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_value(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_value();
-
-  public:
-  // .abd.Tag tag = 1;
-  bool has_tag() const;
-  void clear_tag() ;
-  const ::abd::Tag& tag() const;
-  [[nodiscard]] ::abd::Tag* PROTOBUF_NULLABLE release_tag();
-  ::abd::Tag* PROTOBUF_NONNULL mutable_tag();
-  void set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value);
-  ::abd::Tag* PROTOBUF_NULLABLE unsafe_arena_release_tag();
-
-  private:
-  const ::abd::Tag& _internal_tag() const;
-  ::abd::Tag* PROTOBUF_NONNULL _internal_mutable_tag();
-
-  public:
-  // @@protoc_insertion_point(class_scope:abd.ReadQueryReply)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
-                                   1, 0,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
-  struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ReadQueryReply& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr value_;
-    ::abd::Tag* PROTOBUF_NULLABLE tag_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_abd_2eproto;
-};
-
-extern const ::google::protobuf::internal::ClassDataFull ReadQueryReply_class_data_;
-
-// ===================================================================
-
-
-
-
-// ===================================================================
-
-
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// Tag
-
-// uint64 counter = 1;
-inline void Tag::clear_counter() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.counter_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline ::uint64_t Tag::counter() const {
-  // @@protoc_insertion_point(field_get:abd.Tag.counter)
-  return _internal_counter();
-}
-inline void Tag::set_counter(::uint64_t value) {
-  _internal_set_counter(value);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_set:abd.Tag.counter)
-}
-inline ::uint64_t Tag::_internal_counter() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.counter_;
-}
-inline void Tag::_internal_set_counter(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.counter_ = value;
-}
-
-// string client_id = 2;
-inline void Tag::clear_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_id_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& Tag::client_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.Tag.client_id)
-  return _internal_client_id();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void Tag::set_client_id(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.client_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.Tag.client_id)
-}
-inline ::std::string* PROTOBUF_NONNULL Tag::mutable_client_id()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_client_id();
-  // @@protoc_insertion_point(field_mutable:abd.Tag.client_id)
-  return _s;
-}
-inline const ::std::string& Tag::_internal_client_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.client_id_.Get();
-}
-inline void Tag::_internal_set_client_id(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.client_id_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL Tag::_internal_mutable_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.client_id_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE Tag::release_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.Tag.client_id)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.client_id_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.client_id_.Set("", GetArena());
-  }
-  return released;
-}
-inline void Tag::set_allocated_client_id(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.client_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.client_id_.IsDefault()) {
-    _impl_.client_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.Tag.client_id)
-}
-
-// -------------------------------------------------------------------
-
-// WriteQueryRequest
-
-// string key = 1;
-inline void WriteQueryRequest::clear_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& WriteQueryRequest::key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.WriteQueryRequest.key)
-  return _internal_key();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void WriteQueryRequest::set_key(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.WriteQueryRequest.key)
-}
-inline ::std::string* PROTOBUF_NONNULL WriteQueryRequest::mutable_key()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:abd.WriteQueryRequest.key)
-  return _s;
-}
-inline const ::std::string& WriteQueryRequest::_internal_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.key_.Get();
-}
-inline void WriteQueryRequest::_internal_set_key(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL WriteQueryRequest::_internal_mutable_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.key_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE WriteQueryRequest::release_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.WriteQueryRequest.key)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.key_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  return released;
-}
-inline void WriteQueryRequest::set_allocated_key(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.WriteQueryRequest.key)
-}
-
-// -------------------------------------------------------------------
-
-// WriteQueryReply
-
-// .abd.Tag tag = 1;
-inline bool WriteQueryReply::has_tag() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.tag_ != nullptr);
-  return value;
-}
-inline void WriteQueryReply::clear_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.tag_ != nullptr) _impl_.tag_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::abd::Tag& WriteQueryReply::_internal_tag() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  const ::abd::Tag* p = _impl_.tag_;
-  return p != nullptr ? *p : reinterpret_cast<const ::abd::Tag&>(::abd::_Tag_default_instance_);
-}
-inline const ::abd::Tag& WriteQueryReply::tag() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.WriteQueryReply.tag)
-  return _internal_tag();
-}
-inline void WriteQueryReply::unsafe_arena_set_allocated_tag(
-    ::abd::Tag* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.tag_);
-  }
-  _impl_.tag_ = reinterpret_cast<::abd::Tag*>(value);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:abd.WriteQueryReply.tag)
-}
-inline ::abd::Tag* PROTOBUF_NULLABLE WriteQueryReply::release_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::abd::Tag* released = _impl_.tag_;
-  _impl_.tag_ = nullptr;
-  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
-    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
-    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    if (GetArena() == nullptr) {
-      delete old;
-    }
-  } else {
-    if (GetArena() != nullptr) {
-      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    }
-  }
-  return released;
-}
-inline ::abd::Tag* PROTOBUF_NULLABLE WriteQueryReply::unsafe_arena_release_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.WriteQueryReply.tag)
-
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::abd::Tag* temp = _impl_.tag_;
-  _impl_.tag_ = nullptr;
-  return temp;
-}
-inline ::abd::Tag* PROTOBUF_NONNULL WriteQueryReply::_internal_mutable_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.tag_ == nullptr) {
-    auto* p = ::google::protobuf::Message::DefaultConstruct<::abd::Tag>(GetArena());
-    _impl_.tag_ = reinterpret_cast<::abd::Tag*>(p);
-  }
-  return _impl_.tag_;
-}
-inline ::abd::Tag* PROTOBUF_NONNULL WriteQueryReply::mutable_tag()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  ::abd::Tag* _msg = _internal_mutable_tag();
-  // @@protoc_insertion_point(field_mutable:abd.WriteQueryReply.tag)
-  return _msg;
-}
-inline void WriteQueryReply::set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (message_arena == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.tag_);
-  }
-
-  if (value != nullptr) {
-    ::google::protobuf::Arena* submessage_arena = value->GetArena();
-    if (message_arena != submessage_arena) {
-      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-
-  _impl_.tag_ = reinterpret_cast<::abd::Tag*>(value);
-  // @@protoc_insertion_point(field_set_allocated:abd.WriteQueryReply.tag)
-}
-
-// -------------------------------------------------------------------
-
-// ReadQueryRequest
-
-// string key = 1;
-inline void ReadQueryRequest::clear_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& ReadQueryRequest::key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.ReadQueryRequest.key)
-  return _internal_key();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void ReadQueryRequest::set_key(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.ReadQueryRequest.key)
-}
-inline ::std::string* PROTOBUF_NONNULL ReadQueryRequest::mutable_key()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:abd.ReadQueryRequest.key)
-  return _s;
-}
-inline const ::std::string& ReadQueryRequest::_internal_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.key_.Get();
-}
-inline void ReadQueryRequest::_internal_set_key(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL ReadQueryRequest::_internal_mutable_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.key_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE ReadQueryRequest::release_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.ReadQueryRequest.key)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.key_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ReadQueryRequest::set_allocated_key(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.ReadQueryRequest.key)
-}
-
-// -------------------------------------------------------------------
-
-// ReadQueryReply
-
-// .abd.Tag tag = 1;
-inline bool ReadQueryReply::has_tag() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.tag_ != nullptr);
-  return value;
-}
-inline void ReadQueryReply::clear_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.tag_ != nullptr) _impl_.tag_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const ::abd::Tag& ReadQueryReply::_internal_tag() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  const ::abd::Tag* p = _impl_.tag_;
-  return p != nullptr ? *p : reinterpret_cast<const ::abd::Tag&>(::abd::_Tag_default_instance_);
-}
-inline const ::abd::Tag& ReadQueryReply::tag() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.ReadQueryReply.tag)
-  return _internal_tag();
-}
-inline void ReadQueryReply::unsafe_arena_set_allocated_tag(
-    ::abd::Tag* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.tag_);
-  }
-  _impl_.tag_ = reinterpret_cast<::abd::Tag*>(value);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:abd.ReadQueryReply.tag)
-}
-inline ::abd::Tag* PROTOBUF_NULLABLE ReadQueryReply::release_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::abd::Tag* released = _impl_.tag_;
-  _impl_.tag_ = nullptr;
-  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
-    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
-    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    if (GetArena() == nullptr) {
-      delete old;
-    }
-  } else {
-    if (GetArena() != nullptr) {
-      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    }
-  }
-  return released;
-}
-inline ::abd::Tag* PROTOBUF_NULLABLE ReadQueryReply::unsafe_arena_release_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.ReadQueryReply.tag)
-
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::abd::Tag* temp = _impl_.tag_;
-  _impl_.tag_ = nullptr;
-  return temp;
-}
-inline ::abd::Tag* PROTOBUF_NONNULL ReadQueryReply::_internal_mutable_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.tag_ == nullptr) {
-    auto* p = ::google::protobuf::Message::DefaultConstruct<::abd::Tag>(GetArena());
-    _impl_.tag_ = reinterpret_cast<::abd::Tag*>(p);
-  }
-  return _impl_.tag_;
-}
-inline ::abd::Tag* PROTOBUF_NONNULL ReadQueryReply::mutable_tag()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  ::abd::Tag* _msg = _internal_mutable_tag();
-  // @@protoc_insertion_point(field_mutable:abd.ReadQueryReply.tag)
-  return _msg;
-}
-inline void ReadQueryReply::set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (message_arena == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.tag_);
-  }
-
-  if (value != nullptr) {
-    ::google::protobuf::Arena* submessage_arena = value->GetArena();
-    if (message_arena != submessage_arena) {
-      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-
-  _impl_.tag_ = reinterpret_cast<::abd::Tag*>(value);
-  // @@protoc_insertion_point(field_set_allocated:abd.ReadQueryReply.tag)
-}
-
-// bytes value = 2;
-inline void ReadQueryReply::clear_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.value_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& ReadQueryReply::value() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.ReadQueryReply.value)
-  return _internal_value();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void ReadQueryReply::set_value(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.value_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.ReadQueryReply.value)
-}
-inline ::std::string* PROTOBUF_NONNULL ReadQueryReply::mutable_value()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:abd.ReadQueryReply.value)
-  return _s;
-}
-inline const ::std::string& ReadQueryReply::_internal_value() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.value_.Get();
-}
-inline void ReadQueryReply::_internal_set_value(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.value_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL ReadQueryReply::_internal_mutable_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.value_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE ReadQueryReply::release_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.ReadQueryReply.value)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.value_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.value_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ReadQueryReply::set_allocated_value(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.value_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.ReadQueryReply.value)
-}
-
-// -------------------------------------------------------------------
-
-// WritePropRequest
-
-// string key = 1;
-inline void WritePropRequest::clear_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& WritePropRequest::key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.WritePropRequest.key)
-  return _internal_key();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void WritePropRequest::set_key(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.WritePropRequest.key)
-}
-inline ::std::string* PROTOBUF_NONNULL WritePropRequest::mutable_key()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:abd.WritePropRequest.key)
-  return _s;
-}
-inline const ::std::string& WritePropRequest::_internal_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.key_.Get();
-}
-inline void WritePropRequest::_internal_set_key(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL WritePropRequest::_internal_mutable_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.key_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE WritePropRequest::release_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.WritePropRequest.key)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.key_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  return released;
-}
-inline void WritePropRequest::set_allocated_key(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.WritePropRequest.key)
-}
-
-// .abd.Tag tag = 2;
-inline bool WritePropRequest::has_tag() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.tag_ != nullptr);
-  return value;
-}
-inline void WritePropRequest::clear_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.tag_ != nullptr) _impl_.tag_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000004u;
-}
-inline const ::abd::Tag& WritePropRequest::_internal_tag() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  const ::abd::Tag* p = _impl_.tag_;
-  return p != nullptr ? *p : reinterpret_cast<const ::abd::Tag&>(::abd::_Tag_default_instance_);
-}
-inline const ::abd::Tag& WritePropRequest::tag() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.WritePropRequest.tag)
-  return _internal_tag();
-}
-inline void WritePropRequest::unsafe_arena_set_allocated_tag(
-    ::abd::Tag* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.tag_);
-  }
-  _impl_.tag_ = reinterpret_cast<::abd::Tag*>(value);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000004u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000004u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:abd.WritePropRequest.tag)
-}
-inline ::abd::Tag* PROTOBUF_NULLABLE WritePropRequest::release_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-
-  _impl_._has_bits_[0] &= ~0x00000004u;
-  ::abd::Tag* released = _impl_.tag_;
-  _impl_.tag_ = nullptr;
-  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
-    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
-    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    if (GetArena() == nullptr) {
-      delete old;
-    }
-  } else {
-    if (GetArena() != nullptr) {
-      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    }
-  }
-  return released;
-}
-inline ::abd::Tag* PROTOBUF_NULLABLE WritePropRequest::unsafe_arena_release_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.WritePropRequest.tag)
-
-  _impl_._has_bits_[0] &= ~0x00000004u;
-  ::abd::Tag* temp = _impl_.tag_;
-  _impl_.tag_ = nullptr;
-  return temp;
-}
-inline ::abd::Tag* PROTOBUF_NONNULL WritePropRequest::_internal_mutable_tag() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.tag_ == nullptr) {
-    auto* p = ::google::protobuf::Message::DefaultConstruct<::abd::Tag>(GetArena());
-    _impl_.tag_ = reinterpret_cast<::abd::Tag*>(p);
-  }
-  return _impl_.tag_;
-}
-inline ::abd::Tag* PROTOBUF_NONNULL WritePropRequest::mutable_tag()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  _impl_._has_bits_[0] |= 0x00000004u;
-  ::abd::Tag* _msg = _internal_mutable_tag();
-  // @@protoc_insertion_point(field_mutable:abd.WritePropRequest.tag)
-  return _msg;
-}
-inline void WritePropRequest::set_allocated_tag(::abd::Tag* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (message_arena == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.tag_);
-  }
-
-  if (value != nullptr) {
-    ::google::protobuf::Arena* submessage_arena = value->GetArena();
-    if (message_arena != submessage_arena) {
-      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000004u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000004u;
-  }
-
-  _impl_.tag_ = reinterpret_cast<::abd::Tag*>(value);
-  // @@protoc_insertion_point(field_set_allocated:abd.WritePropRequest.tag)
-}
-
-// bytes value = 3;
-inline void WritePropRequest::clear_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.value_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const ::std::string& WritePropRequest::value() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.WritePropRequest.value)
-  return _internal_value();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void WritePropRequest::set_value(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.value_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.WritePropRequest.value)
-}
-inline ::std::string* PROTOBUF_NONNULL WritePropRequest::mutable_value()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:abd.WritePropRequest.value)
-  return _s;
-}
-inline const ::std::string& WritePropRequest::_internal_value() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.value_.Get();
-}
-inline void WritePropRequest::_internal_set_value(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.value_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL WritePropRequest::_internal_mutable_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.value_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE WritePropRequest::release_value() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.WritePropRequest.value)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.value_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.value_.Set("", GetArena());
-  }
-  return released;
-}
-inline void WritePropRequest::set_allocated_value(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.value_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.WritePropRequest.value)
-}
-
-// -------------------------------------------------------------------
-
-// Ack
-
-// bool ok = 1;
-inline void Ack::clear_ok() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ok_ = false;
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline bool Ack::ok() const {
-  // @@protoc_insertion_point(field_get:abd.Ack.ok)
-  return _internal_ok();
-}
-inline void Ack::set_ok(bool value) {
-  _internal_set_ok(value);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_set:abd.Ack.ok)
-}
-inline bool Ack::_internal_ok() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.ok_;
-}
-inline void Ack::_internal_set_ok(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ok_ = value;
-}
-
-// string error = 2;
-inline void Ack::clear_error() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.error_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& Ack::error() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.Ack.error)
-  return _internal_error();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void Ack::set_error(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.error_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.Ack.error)
-}
-inline ::std::string* PROTOBUF_NONNULL Ack::mutable_error()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:abd.Ack.error)
-  return _s;
-}
-inline const ::std::string& Ack::_internal_error() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.error_.Get();
-}
-inline void Ack::_internal_set_error(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.error_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL Ack::_internal_mutable_error() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.error_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE Ack::release_error() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.Ack.error)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.error_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.error_.Set("", GetArena());
-  }
-  return released;
-}
-inline void Ack::set_allocated_error(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.error_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.Ack.error)
-}
-
-// -------------------------------------------------------------------
-
-// AcquireLockRequest
-
-// string key = 1;
-inline void AcquireLockRequest::clear_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& AcquireLockRequest::key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.AcquireLockRequest.key)
-  return _internal_key();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void AcquireLockRequest::set_key(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.AcquireLockRequest.key)
-}
-inline ::std::string* PROTOBUF_NONNULL AcquireLockRequest::mutable_key()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:abd.AcquireLockRequest.key)
-  return _s;
-}
-inline const ::std::string& AcquireLockRequest::_internal_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.key_.Get();
-}
-inline void AcquireLockRequest::_internal_set_key(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL AcquireLockRequest::_internal_mutable_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.key_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE AcquireLockRequest::release_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.AcquireLockRequest.key)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.key_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  return released;
-}
-inline void AcquireLockRequest::set_allocated_key(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.AcquireLockRequest.key)
-}
-
-// string client_id = 2;
-inline void AcquireLockRequest::clear_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_id_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const ::std::string& AcquireLockRequest::client_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.AcquireLockRequest.client_id)
-  return _internal_client_id();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void AcquireLockRequest::set_client_id(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.client_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.AcquireLockRequest.client_id)
-}
-inline ::std::string* PROTOBUF_NONNULL AcquireLockRequest::mutable_client_id()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_client_id();
-  // @@protoc_insertion_point(field_mutable:abd.AcquireLockRequest.client_id)
-  return _s;
-}
-inline const ::std::string& AcquireLockRequest::_internal_client_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.client_id_.Get();
-}
-inline void AcquireLockRequest::_internal_set_client_id(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.client_id_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL AcquireLockRequest::_internal_mutable_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.client_id_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE AcquireLockRequest::release_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.AcquireLockRequest.client_id)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.client_id_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.client_id_.Set("", GetArena());
-  }
-  return released;
-}
-inline void AcquireLockRequest::set_allocated_client_id(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.client_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.client_id_.IsDefault()) {
-    _impl_.client_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.AcquireLockRequest.client_id)
-}
-
-// -------------------------------------------------------------------
-
-// AcquireLockReply
-
-// bool granted = 1;
-inline void AcquireLockReply::clear_granted() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.granted_ = false;
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline bool AcquireLockReply::granted() const {
-  // @@protoc_insertion_point(field_get:abd.AcquireLockReply.granted)
-  return _internal_granted();
-}
-inline void AcquireLockReply::set_granted(bool value) {
-  _internal_set_granted(value);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  // @@protoc_insertion_point(field_set:abd.AcquireLockReply.granted)
-}
-inline bool AcquireLockReply::_internal_granted() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.granted_;
-}
-inline void AcquireLockReply::_internal_set_granted(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.granted_ = value;
-}
-
-// string holder = 2;
-inline void AcquireLockReply::clear_holder() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.holder_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& AcquireLockReply::holder() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.AcquireLockReply.holder)
-  return _internal_holder();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void AcquireLockReply::set_holder(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.holder_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.AcquireLockReply.holder)
-}
-inline ::std::string* PROTOBUF_NONNULL AcquireLockReply::mutable_holder()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_holder();
-  // @@protoc_insertion_point(field_mutable:abd.AcquireLockReply.holder)
-  return _s;
-}
-inline const ::std::string& AcquireLockReply::_internal_holder() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.holder_.Get();
-}
-inline void AcquireLockReply::_internal_set_holder(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.holder_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL AcquireLockReply::_internal_mutable_holder() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.holder_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE AcquireLockReply::release_holder() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.AcquireLockReply.holder)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.holder_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.holder_.Set("", GetArena());
-  }
-  return released;
-}
-inline void AcquireLockReply::set_allocated_holder(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.holder_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.holder_.IsDefault()) {
-    _impl_.holder_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.AcquireLockReply.holder)
-}
-
-// -------------------------------------------------------------------
-
-// ReleaseLockRequest
-
-// string key = 1;
-inline void ReleaseLockRequest::clear_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const ::std::string& ReleaseLockRequest::key() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.ReleaseLockRequest.key)
-  return _internal_key();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void ReleaseLockRequest::set_key(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.ReleaseLockRequest.key)
-}
-inline ::std::string* PROTOBUF_NONNULL ReleaseLockRequest::mutable_key()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:abd.ReleaseLockRequest.key)
-  return _s;
-}
-inline const ::std::string& ReleaseLockRequest::_internal_key() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.key_.Get();
-}
-inline void ReleaseLockRequest::_internal_set_key(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL ReleaseLockRequest::_internal_mutable_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.key_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE ReleaseLockRequest::release_key() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.ReleaseLockRequest.key)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.key_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ReleaseLockRequest::set_allocated_key(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.key_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.ReleaseLockRequest.key)
-}
-
-// string client_id = 2;
-inline void ReleaseLockRequest::clear_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_id_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const ::std::string& ReleaseLockRequest::client_id() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:abd.ReleaseLockRequest.client_id)
-  return _internal_client_id();
-}
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void ReleaseLockRequest::set_client_id(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.client_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:abd.ReleaseLockRequest.client_id)
-}
-inline ::std::string* PROTOBUF_NONNULL ReleaseLockRequest::mutable_client_id()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_client_id();
-  // @@protoc_insertion_point(field_mutable:abd.ReleaseLockRequest.client_id)
-  return _s;
-}
-inline const ::std::string& ReleaseLockRequest::_internal_client_id() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.client_id_.Get();
-}
-inline void ReleaseLockRequest::_internal_set_client_id(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.client_id_.Set(value, GetArena());
-}
-inline ::std::string* PROTOBUF_NONNULL ReleaseLockRequest::_internal_mutable_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.client_id_.Mutable( GetArena());
-}
-inline ::std::string* PROTOBUF_NULLABLE ReleaseLockRequest::release_client_id() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:abd.ReleaseLockRequest.client_id)
-  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* released = _impl_.client_id_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.client_id_.Set("", GetArena());
-  }
-  return released;
-}
-inline void ReleaseLockRequest::set_allocated_client_id(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.client_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.client_id_.IsDefault()) {
-    _impl_.client_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:abd.ReleaseLockRequest.client_id)
-}
-
-// -------------------------------------------------------------------
-
-// ReleaseLockReply
-
-// bool ok = 1;
-inline void ReleaseLockReply::clear_ok() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ok_ = false;
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline bool ReleaseLockReply::ok() const {
-  // @@protoc_insertion_point(field_get:abd.ReleaseLockReply.ok)
-  return _internal_ok();
-}
-inline void ReleaseLockReply::set_ok(bool value) {
-  _internal_set_ok(value);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  // @@protoc_insertion_point(field_set:abd.ReleaseLockReply.ok)
-}
-inline bool ReleaseLockReply::_internal_ok() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.ok_;
-}
-inline void ReleaseLockReply::_internal_set_ok(bool value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ok_ = value;
-}
-
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif  // __GNUC__
-
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace abd
-
-
-// @@protoc_insertion_point(global_scope)
-
-#include "google/protobuf/port_undef.inc"
-
-#endif  // abd_2eproto_2epb_2eh
@@ -0,0 +1,228 @@
+#!/usr/bin/env bash
+# End-to-end checks against real replicas on localhost (make scenarios). Every scenario
+# starts its own async_server processes in a scratch directory, drives them with the
+# client binaries and checks what they print. Exit status is the number of failed checks.
+#
+#   failover-get  PUT with one replica down, restart that one empty, kill another: the
+#                 same client's GET still returns the value (its near cache must not lose
+#                 to the empty replica), and a fresh client reads it too (the write-back
+#                 repaired the quorum). Run for abd and blocking.
+#   migration     move group [a] to generation 2 under load: no op fails, the old
+#                 replicas get retired, a client (or a mover's Scan) on the old
+#                 servers.conf is refused and one on the new file reads the moved values.
+#                 Then with blocking: moving keys are refused and counted, nothing fails.
+#
+# BIN (default bin) is where the binaries are, BASE_PORT (default 56000) the first of
+# the ports used; SCENARIOS picks a subset, e.g. SCENARIOS="failover-get".
+
+set -u
+
+BIN=$(cd "${BIN:-bin}" && pwd) || exit 1
+BASE_PORT=${BASE_PORT:-56000}
+SCENARIOS=${SCENARIOS:-"failover-get migration"}
+
+WORK=$(mktemp -d /tmp/abd-scenarios.XXXXXX)
+SERVER_PIDS=()
+FAILED=0
+
+cleanup() {
+    for pid in "${SERVER_PIDS[@]}"; do kill "$pid" 2>/dev/null; done
+    wait 2>/dev/null
+}
+trap cleanup EXIT
+
+# start_server port dir: a fresh (empty) replica, logging to dir/server-port.log
+start_server() {
+    # (3>&-: a replica must not hold a client's input fifo open, see failover_get)
+    "$BIN/async_server" "127.0.0.1:$1" > "$2/server-$1.log" 2>&1 3>&- &
+    SERVER_PIDS+=($!)
+    eval "SERVER_$1=$!"
+    for _ in $(seq 50); do
+        grep -q "listening" "$2/server-$1.log" 2>/dev/null && return 0
+        sleep 0.1
+    done
+    echo "  replica on port $1 did not come up" >&2
+    return 1
+}
+
+stop_server() {
+    local var="SERVER_$1"
+    kill "${!var}" 2>/dev/null
+    wait "${!var}" 2>/dev/null
+}
+
+# new_dir name: scratch directory laid out the way the client mains expect
+new_dir() {
+    local dir="$WORK/$1"
+    mkdir -p "$dir/input" "$dir/logs/input"
+    echo "$dir"
+}
+
+# servers_conf file name generation port...
+servers_conf() {
+    local file=$1 name=$2 generation=$3
+    shift 3
+    {
+        echo "[$name]"
+        echo "generation = $generation"
+        for p in "$@"; do echo "127.0.0.1:$p"; done
+    } > "$file"
+}
+
+wait_for() {
+    for _ in $(seq 100); do
+        grep -q -- "$1" "$2" 2>/dev/null && return 0
+        sleep 0.1
+    done
+    return 1
+}
+
+# one second's worth of wait_for
+wait_for_once() {
+    for _ in $(seq 10); do
+        grep -q -- "$1" "$2" 2>/dev/null && return 0
+        sleep 0.1
+    done
+    return 1
+}
+
+check() {
+    local what=$1
+    shift
+    if "$@"; then
+        echo "  ok    $what"
+    else
+        echo "  FAIL  $what"
+        FAILED=$((FAILED + 1))
+    fi
+}
+
+failover_get() {
+    local client=$1 p1=$2 p2=$3 p3=$4
+    local dir
+    dir=$(new_dir "failover-$client")
+    servers_conf "$dir/servers.conf" a 1 "$p1" "$p2" "$p3"
+    start_server "$p1" "$dir" && start_server "$p2" "$dir" || return
+
+    # one client process for the whole story, fed line by line, so its cache survives
+    mkfifo "$dir/input/ops"
+    (cd "$dir" && stdbuf -oL "$BIN/$client" input/ops > out.log 2> err.log) &
+    local client_pid=$!
+    exec 3> "$dir/input/ops"
+
+    echo "PUT k v1" >&3
+    check "$client: PUT with $p3 down" wait_for " PUT k = v1" "$dir/out.log"
+
+    start_server "$p3" "$dir"
+    stop_server "$p1"
+    # gRPC fails calls fast while a channel is in reconnect backoff, so poke the client
+    # with GETs of another key until the restarted replica (and with it a quorum) answers
+    for _ in $(seq 30); do
+        echo "GET warm-up" >&3
+        wait_for_once " GET warm-up -> " "$dir/out.log" && break
+    done
+    echo "GET k" >&3
+    exec 3>&-
+    wait "$client_pid"
+    check "$client: GET after $p3 restarted empty and $p1 died returns v1" \
+        grep -q " GET k -> v1 " "$dir/out.log"
+
+    # no cache: only the write-back can have put v1 on the empty replica
+    echo "GET k" > "$dir/input/fresh"
+    (cd "$dir" && "$BIN/$client" input/fresh > fresh.log 2>&1)
+    check "$client: a fresh client reads v1 from the surviving pair" grep -q " GET k -> v1 " "$dir/fresh.log"
+
+    stop_server "$p2"
+    stop_server "$p3"
+}
+
+migration() {
+    local p1=$1 p2=$2 p3=$3 p4=$4
+    local dir
+    dir=$(new_dir migration)
+    servers_conf "$dir/servers.conf" a 1 "$p1" "$p2" "$p3"
+    servers_conf "$dir/next.conf" a 2 "$p2" "$p3" "$p4"
+    for p in "$p1" "$p2" "$p3" "$p4"; do start_server "$p" "$dir" || return; done
+
+    for round in 1 2 3 4 5; do
+        for i in $(seq 40); do echo "PUT k$i v$i"; echo "GET k$i"; done
+    done > "$dir/input/load"
+    (cd "$dir" && "$BIN/load_driver" --protocol abd --clients 4 --servers servers.conf \
+        --migrate-to next.conf --migrate-after 100 input/load > driver.log 2>&1)
+    check "migration: no op failed" grep -q "Total Operations : .* (0 failed, 0 refused" "$dir/driver.log"
+    check "migration: flipped and retired the 3 old replicas" grep -q "Retired Replicas : 3$" "$dir/driver.log"
+
+    echo "GET k7" > "$dir/input/get"
+    (cd "$dir" && "$BIN/async_client" input/get > stale.log 2>&1)
+    check "migration: a client on the old servers.conf is refused" grep -q "is retired here" "$dir/stale.log"
+    check "migration: ... and does not answer" bash -c "! grep -q ' GET k7 -> ' '$dir/stale.log'"
+
+    mkdir -p "$dir/fresh/input" "$dir/fresh/logs/input"
+    cp "$dir/next.conf" "$dir/fresh/servers.conf"
+    cp "$dir/input/get" "$dir/fresh/input/get"
+    (cd "$dir/fresh" && "$BIN/async_client" input/get > fresh.log 2>&1)
+    check "migration: a client on the new file reads the moved value" grep -q " GET k7 -> v7 " "$dir/fresh/fresh.log"
+
+    # a second mover still on the old file: the retired group won't even be scanned
+    (cd "$dir" && "$BIN/load_driver" --protocol abd --clients 1 --servers servers.conf \
+        --migrate-to next.conf --migrate-after 0 input/get > stale-driver.log 2>&1)
+    check "migration: a stale mover can't scan the retired group" grep -q "Scan of .* is retired here" "$dir/stale-driver.log"
+
+    for p in "$p1" "$p2" "$p3" "$p4"; do stop_server "$p"; done
+}
+
+# same move under the lock protocol: moving keys are refused (and counted) instead of
+# dual-routed, everything else goes through
+migration_blocking() {
+    local p1=$1 p2=$2 p3=$3 p4=$4
+    local dir
+    dir=$(new_dir migration-blocking)
+    servers_conf "$dir/servers.conf" a 1 "$p1" "$p2" "$p3"
+    servers_conf "$dir/next.conf" a 2 "$p2" "$p3" "$p4"
+    for p in "$p1" "$p2" "$p3" "$p4"; do start_server "$p" "$dir" || return; done
+
+    for round in 1 2 3 4 5; do
+        for i in $(seq 40); do echo "PUT k$i v$i"; echo "GET k$i"; done
+    done > "$dir/input/load"
+    (cd "$dir" && "$BIN/load_driver" --protocol blocking --clients 4 --servers servers.conf \
+        --migrate-to next.conf --migrate-after 100 input/load > driver.log 2>&1)
+    check "migration-blocking: nothing failed but the refused moving keys" \
+        grep -q "Total Operations : .* (0 failed, [0-9]* refused: key migrating)" "$dir/driver.log"
+    check "migration-blocking: refusals say why" \
+        bash -c "! grep ' refused' '$dir/driver.log' | grep -v -e 'key migrating' -e 'Total Operations'"
+    check "migration-blocking: flipped and retired the 3 old replicas" grep -q "Retired Replicas : 3$" "$dir/driver.log"
+
+    mkdir -p "$dir/fresh/input" "$dir/fresh/logs/input"
+    cp "$dir/next.conf" "$dir/fresh/servers.conf"
+    echo "GET k7" > "$dir/fresh/input/get"
+    (cd "$dir/fresh" && "$BIN/blocking_client" input/get > fresh.log 2>&1)
+    check "migration-blocking: a client on the new file reads the moved value" grep -q " GET k7 -> v7 " "$dir/fresh/fresh.log"
+
+    for p in "$p1" "$p2" "$p3" "$p4"; do stop_server "$p"; done
+}
+
+for s in $SCENARIOS; do
+    echo "== $s"
+    case $s in
+        failover-get)
+            failover_get async_client $BASE_PORT $((BASE_PORT + 1)) $((BASE_PORT + 2))
+            failover_get blocking_client $((BASE_PORT + 3)) $((BASE_PORT + 4)) $((BASE_PORT + 5))
+            ;;
+        migration)
+            migration $((BASE_PORT + 6)) $((BASE_PORT + 7)) $((BASE_PORT + 8)) $((BASE_PORT + 9))
+            migration_blocking $((BASE_PORT + 10)) $((BASE_PORT + 11)) $((BASE_PORT + 12)) $((BASE_PORT + 13))
+            ;;
+        *)
+            echo "unknown scenario: $s" >&2
+            FAILED=$((FAILED + 1))
+            ;;
+    esac
+done
+
+if [ "$FAILED" -eq 0 ]; then
+    rm -rf "$WORK"
+    echo "all scenarios passed"
+else
+    echo "$FAILED check(s) failed, logs in $WORK"
+fi
+exit "$FAILED"
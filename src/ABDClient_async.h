@@ -0,0 +1,517 @@
+#pragma once
+
+#include "proto/abd.grpc.pb.h"
+#include "proto/abd.pb.h"
+#include "src/Consistency.h"
+#include "src/NearCache.h"
+#include "src/QuorumCall.h"
+#include "src/SingleWriterTags.h"
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <sys/types.h>
+#include <unistd.h>
+#include <vector>
+
+class ABDClient {
+public:
+    explicit ABDClient(const std::vector<std::string>& server_addrs)
+    {
+        for (const auto& addr : server_addrs) {
+            std::shared_ptr<grpc::Channel> ch = grpc::CreateChannel(addr, grpc::InsecureChannelCredentials());
+            std::unique_ptr<abd::ABDService::Stub> stub = abd::ABDService::NewStub(ch);
+            std::unique_ptr<grpc::GenericStub> generic_stub(new grpc::GenericStub(ch));
+            replicas_.push_back({addr, std::move(ch), std::move(stub), std::move(generic_stub)});
+            std::cout << "ABDClient connecting to " << addr << "\n";
+        }
+        InitQuorums();
+        client_id_ = std::to_string(getpid());
+        coordinator_ = static_cast<int>(getpid() % N_);
+    }
+
+    // Logical client over channels owned by someone else (load driver): many of these
+    // share one connection per replica, so each needs its own client_id for tags/locks.
+    ABDClient(const std::vector<std::string>& server_addrs,
+              const std::vector<std::shared_ptr<grpc::Channel>>& channels,
+              const std::string& client_id)
+    {
+        for (size_t i = 0; i < server_addrs.size(); ++i) {
+            replicas_.push_back({server_addrs[i], channels[i], abd::ABDService::NewStub(channels[i]),
+                                 std::unique_ptr<grpc::GenericStub>(new grpc::GenericStub(channels[i]))});
+        }
+        InitQuorums();
+        client_id_ = client_id;
+        // spread logical clients over the replicas as coordinators
+        coordinator_ = static_cast<int>(std::hash<std::string>()(client_id) % N_);
+    }
+
+    // per-op stdout lines; the load driver turns these off
+    void SetVerbose(bool verbose) { verbose_ = verbose; }
+
+    // Keys matching owned->Prefixes() are written single-writer style (see SingleWriterTags.h)
+    void SetOwnedKeys(std::shared_ptr<SingleWriterTags> owned) { owned_ = std::move(owned); }
+
+    // Flexible quorums: GETs query R replicas, PUTs and GET write-backs wait for W, a PUT's
+    // WriteQuery needs R. Only safe with R + W > N and W > N/2, see ValidateQuorums.
+    void SetQuorums(int R, int W)
+    {
+        R_ = R;
+        W_ = W;
+    }
+
+    // Try PUTs in one round first, at (cached tag + 1), see ConditionalPropRound
+    void SetOptimisticPuts(bool optimistic) { optimistic_ = optimistic; }
+    long OneRoundPuts() const { return one_round_puts_; }
+
+    // Hand whole ops to one replica (CoordinatedPut/Get) instead of running the phases
+    // from here; the replicas need to have been started with --peers
+    void SetCoordinated(bool coordinated) { coordinated_ = coordinated; }
+
+    // Our servers.conf generation of this group, sent on every request. Replicas retired
+    // by a migration to a newer generation refuse it (see RetireRequest), so a client on
+    // an outdated file fails its ops instead of quietly working on the old replica set.
+    void SetGeneration(int generation)
+    {
+        generation_ = static_cast<uint32_t>(generation);
+        write_query_->request().set_generation(generation_);
+        read_query_->request().set_generation(generation_);
+        write_prop_->request().set_generation(generation_);
+    }
+
+    // Tag of the last successful Put/Get (what the coordinator side sends back)
+    const abd::Tag& LastTag() const { return last_tag_; }
+
+    bool Put(const std::string& key, const std::string& value)
+    {
+        if (coordinated_) return CoordinatedPut(key, value);
+
+        abd::WritePropRequest& req = write_prop_->request();
+        req.set_key(key);
+        req.mutable_tag()->set_client_id(client_id_);
+        req.set_value(value);
+
+        bool one_round = false;
+        uint64_t counter;
+        const bool owned = owned_ && owned_->Owns(key);
+        if (!owned || !owned_->Next(key, counter)) {
+            // multi-writer, or the owner's first PUT on the key this run (recovery)
+            abd::Tag max_tag;
+            bool have_max = false;
+            uint64_t tried = 0;
+            const NearCache::Entry* hint = (optimistic_ && !owned) ? near_cache_.Find(key) : nullptr;
+            if (hint) {
+                tried = hint->tag.counter() + 1;
+                one_round = ConditionalPropRound(key, tried, max_tag, have_max);
+            }
+            if (!one_round) {
+                if (!have_max && !QueryMaxTag(key, max_tag)) return false;
+                // also above whatever the optimistic try may have left on a minority
+                counter = std::max<uint64_t>(max_tag.counter(), tried) + 1;
+                if (owned) owned_->Recovered(key, counter);
+            }
+        }
+
+        if (one_round) {
+            one_round_puts_++;
+        } else {
+            req.mutable_tag()->set_counter(counter);
+
+            // writeprop to all replicas
+            int ack_count = WritePropRound(key, W_, false);
+
+            if (ack_count < W_) {
+                std::cerr << "PUT " << key
+                          << " failed: did not reach write quorum in WriteProp phase ("
+                          << ack_count << " < " << W_ << ")\n";
+                return false;
+            }
+        }
+
+        near_cache_.Update(key, req.tag(), value);
+        last_tag_ = req.tag();
+        if (verbose_) std::cout << " PUT " << key << " = " << value
+                  << " (tag.counter=" << req.tag().counter()
+                  << ", tag.client_id=" << req.tag().client_id() << ")\n";
+        return true;
+    }
+
+    bool Get(const std::string& key, std::string& value_out,
+             Consistency level = Consistency::LINEARIZABLE)
+    {
+        if (coordinated_) return CoordinatedGet(key, value_out, level);
+
+        //the magic, no more useless crowding
+        // offer our cached tag; replicas with nothing newer leave the value out. Our copy
+        // is from a completed op, so it's the floor: only a strictly newer reply beats it.
+        const NearCache::Entry* cached = near_cache_.Find(key);
+        const abd::Tag* max_tag = cached ? &cached->tag : nullptr;
+        const std::string* max_value = cached ? &cached->value : nullptr;
+        int at_cached = 0; // replies that still have exactly our copy
+        int success_count = 0;
+        const int quorum = (level == Consistency::ONE) ? 1 : R_;
+
+        //ReadQuery to all replicas
+        read_query_->Begin();
+        abd::ReadQueryRequest& query = read_query_->request();
+        query.set_key(key);
+        if (cached) {
+            *query.mutable_cached_tag() = cached->tag;
+        } else {
+            query.clear_cached_tag();
+        }
+        for (int i = 0; i < N_; ++i) {
+            read_query_->Add(i, replicas_[i].stub.get());
+        }
+
+        // replies stay in their slots until the next round, so just point at the winner
+        read_query_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::ReadQueryReply& reply) {
+                if (!ok || !status.ok()) {
+                    std::cerr << "ReadQuery to " << replicas_[idx].address
+                              << " failed for GET " << key << ": "
+                              << (status.ok() ? "stream not ok" : status.error_message())
+                              << "\n";
+                    return;
+                }
+                success_count++;
+                if (cached && TagEqual(reply.tag(), cached->tag)) at_cached++;
+                // not-modified replies are <= cached, which already stands in for them
+                if (reply.not_modified()) return;
+                if (!max_tag || TagGreater(reply.tag(), *max_tag)) {
+                    max_tag = &reply.tag();
+                    max_value = &reply.value();
+                }
+            },
+            [&] { return success_count >= quorum; });
+
+        if (success_count < quorum || !max_tag) {
+            std::cerr << "GET " << key
+                      << " failed: did not reach read quorum in ReadQuery phase ("
+                      << success_count << " < " << quorum << ")\n";
+            return false;
+        }
+
+        if (level != Consistency::LINEARIZABLE) {
+            // weaker reads stop at the query; the cache only takes completed values
+            value_out = *max_value;
+            last_tag_ = *max_tag;
+            if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                      << " (tag.counter=" << max_tag->counter()
+                      << ", tag.client_id=" << max_tag->client_id()
+                      << ", " << ConsistencyName(level) << ")\n";
+            return true;
+        }
+
+        if (cached && max_tag == &cached->tag && at_cached >= W_) {
+            // nobody is past our copy and a write quorum of the replies still has it, so
+            // there is nothing to write back. Replicas that lost the key (a restart) or
+            // are behind don't count; short of W like that, the write-back below repairs.
+            value_out = cached->value;
+            last_tag_ = cached->tag;
+            if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                      << " (tag.counter=" << cached->tag.counter()
+                      << ", tag.client_id=" << cached->tag.client_id() << ", not modified)\n";
+            return true;
+        }
+
+        //writeback via WriteProp
+        abd::WritePropRequest& req = write_prop_->request();
+        req.set_key(key);
+        *req.mutable_tag() = *max_tag;
+        req.set_value(*max_value);
+
+        int ack_count = WritePropRound(key, W_, true);
+
+        if (ack_count < W_) {
+            std::cerr << "GET " << key
+                      << " failed: did not reach write quorum in write-back ("
+                      << ack_count << " < " << W_ << ")\n";
+            return false;
+        }
+
+        value_out = req.value();
+        near_cache_.Update(key, req.tag(), req.value());
+        last_tag_ = req.tag();
+        if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                  << " (tag.counter=" << req.tag().counter()
+                  << ", tag.client_id=" << req.tag().client_id() << ")\n";
+        return true;
+    }
+
+    // Single phases for ShardedClient's migration path, which has to combine replies from
+    // two groups itself. Neither touches the near cache.
+    static constexpr bool kDualRoute = true;
+    const std::string& ClientId() const { return client_id_; }
+
+    // ReadQuery round: max (tag, value) over a read quorum
+    bool ReadLatest(const std::string& key, abd::Tag& tag_out, std::string& value_out)
+    {
+        const abd::ReadQueryReply* best = nullptr;
+        int success_count = 0;
+
+        read_query_->Begin();
+        read_query_->request().set_key(key);
+        read_query_->request().clear_cached_tag();
+        for (int i = 0; i < N_; ++i) {
+            read_query_->Add(i, replicas_[i].stub.get());
+        }
+        read_query_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::ReadQueryReply& reply) {
+                if (!ok || !status.ok()) {
+                    std::cerr << "ReadQuery to " << replicas_[idx].address
+                              << " failed for " << key << ": "
+                              << (status.ok() ? "stream not ok" : status.error_message())
+                              << "\n";
+                    return;
+                }
+                success_count++;
+                if (!best || TagGreater(reply.tag(), best->tag())) best = &reply;
+            },
+            [&] { return success_count >= R_; });
+
+        if (success_count < R_ || !best) {
+            std::cerr << "ReadQuery for " << key << " did not reach read quorum ("
+                      << success_count << " < " << R_ << ")\n";
+            return false;
+        }
+        tag_out = best->tag();
+        value_out = best->value();
+        return true;
+    }
+
+    // WriteProp round of (tag, value) to a write quorum
+    bool Propagate(const std::string& key, const abd::Tag& tag, const std::string& value)
+    {
+        abd::WritePropRequest& req = write_prop_->request();
+        req.set_key(key);
+        *req.mutable_tag() = tag;
+        req.set_value(value);
+        int ack_count = WritePropRound(key, W_, false);
+        if (ack_count < W_) {
+            std::cerr << "WriteProp for " << key << " did not reach write quorum ("
+                      << ack_count << " < " << W_ << ")\n";
+            return false;
+        }
+        return true;
+    }
+
+private:
+    struct Replica {
+        std::string address;
+        std::shared_ptr<grpc::Channel> channel;
+        std::unique_ptr<abd::ABDService::Stub> stub;
+        std::unique_ptr<grpc::GenericStub> generic_stub; // pre-serialized WriteProp
+    };
+
+    static bool TagGreater(const abd::Tag& a, const abd::Tag& b)
+    {
+        if (a.counter() != b.counter()) return a.counter() > b.counter();
+        return a.client_id() > b.client_id();
+    }
+
+    static bool TagEqual(const abd::Tag& a, const abd::Tag& b)
+    {
+        return a.counter() == b.counter() && a.client_id() == b.client_id();
+    }
+
+    void InitQuorums()
+    {
+        N_ = static_cast<int>(replicas_.size());
+        R_ = N_ / 2 + 1;
+        W_ = N_ / 2 + 1;
+        write_query_.reset(new WriteQueryCall(N_));
+        read_query_.reset(new ReadQueryCall(N_));
+        write_prop_.reset(new WritePropCall(N_));
+    }
+
+    // Coordinator mode: one blocking RPC to our current coordinator, moving on to the next
+    // replica if it's down. Retrying a PUT elsewhere may write the value twice under two
+    // tags, which is harmless: the later tag just wins with the same value.
+    bool CoordinatedPut(const std::string& key, const std::string& value)
+    {
+        abd::CoordinatedPutRequest req;
+        req.set_key(key);
+        req.set_value(value);
+        req.set_generation(generation_);
+        auto call = [&](abd::ABDService::Stub* stub, grpc::ClientContext* ctx, abd::CoordinatedReply* reply) {
+            return stub->CoordinatedPut(ctx, req, reply);
+        };
+        return Coordinated("PUT", key, call, nullptr);
+    }
+
+    bool CoordinatedGet(const std::string& key, std::string& value_out, Consistency level)
+    {
+        abd::CoordinatedGetRequest req;
+        req.set_key(key);
+        req.set_consistency(static_cast<uint32_t>(level));
+        req.set_generation(generation_);
+        auto call = [&](abd::ABDService::Stub* stub, grpc::ClientContext* ctx, abd::CoordinatedReply* reply) {
+            return stub->CoordinatedGet(ctx, req, reply);
+        };
+        return Coordinated("GET", key, call, &value_out);
+    }
+
+    template <typename Call>
+    bool Coordinated(const char* op, const std::string& key, Call call, std::string* value_out)
+    {
+        for (int attempt = 0; attempt < N_; ++attempt) {
+            Replica& r = replicas_[coordinator_];
+            grpc::ClientContext ctx;
+            abd::CoordinatedReply reply;
+            grpc::Status status = call(r.stub.get(), &ctx, &reply);
+            if (status.ok() && reply.ok()) {
+                last_tag_ = reply.tag();
+                if (value_out) *value_out = reply.value();
+                if (verbose_) std::cout << " " << op << " " << key << " via " << r.address
+                          << " (tag.counter=" << reply.tag().counter()
+                          << ", tag.client_id=" << reply.tag().client_id() << ")\n";
+                return true;
+            }
+            std::cerr << "Coordinated " << op << " " << key << " via " << r.address << " failed: "
+                      << (status.ok() ? reply.error() : status.error_message()) << "\n";
+            if (status.ok()) return false; // the coordinator itself couldn't reach a quorum
+            // stale generation (or no --peers): every replica will say the same
+            if (status.error_code() == grpc::StatusCode::FAILED_PRECONDITION) return false;
+            coordinator_ = (coordinator_ + 1) % N_;
+        }
+        return false;
+    }
+
+    // WriteQuery round: max tag over a read quorum (meets every completed write's W
+    // replicas since R + W > N), false if we couldn't get one
+    bool QueryMaxTag(const std::string& key, abd::Tag& max_tag)
+    {
+        //WriteQuery to all replicas, ;')
+        max_tag.set_counter(0);
+        max_tag.set_client_id("");
+        bool have_tag = false;
+        int success_count = 0;
+
+        //shoutouts to https://grpc.io/docs/languages/cpp/async/ for saving my bacon, though to be fair i should have been more vigilant
+        write_query_->Begin();
+        write_query_->request().set_key(key);
+        for (int i = 0; i < N_; ++i) {
+            write_query_->Add(i, replicas_[i].stub.get());
+        }
+
+        write_query_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::WriteQueryReply& reply) {
+                if (!ok || !status.ok()) {
+                    std::cerr << "WriteQuery to " << replicas_[idx].address
+                              << " failed for PUT " << key << ": "
+                              << (status.ok() ? "stream not ok" : status.error_message())
+                              << "\n";
+                    return;
+                }
+                success_count++;
+                const abd::Tag& t = reply.tag();
+                if (!have_tag || TagGreater(t, max_tag)) {
+                    max_tag = t;
+                    have_tag = true;
+                }
+            },
+            [&] { return success_count >= R_; });
+
+        if (success_count < R_) {
+            std::cerr << "PUT " << key
+                      << " failed: did not reach read quorum in WriteQuery phase ("
+                      << success_count << " < " << R_ << ")\n";
+            return false;
+        }
+        return true;
+    }
+
+    // Optimistic PUT: conditional WriteProp of write_prop_->request() at (counter, client_id_),
+    // which replicas only apply if it beats their tag. If a write quorum applies it, the
+    // PUT is done: any write that completed before us sits on a write quorum too, and since
+    // W > N/2 one of those replicas would have refused. Otherwise, once a read quorum has
+    // answered, max_tag (our tag vs. the tags refusers reported) is as good as a
+    // WriteQuery result and the fallback can go straight to phase 2.
+    bool ConditionalPropRound(const std::string& key, uint64_t counter, abd::Tag& max_tag, bool& have_max)
+    {
+        abd::WritePropRequest& req = write_prop_->request();
+        req.mutable_tag()->set_counter(counter);
+        req.set_conditional(true);
+        max_tag = req.tag();
+        int replied = 0;
+        int applied = 0;
+
+        write_prop_->Begin();
+        for (int i = 0; i < N_; ++i) {
+            write_prop_->Add(i, replicas_[i].generic_stub.get());
+        }
+        write_prop_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::Ack& reply) {
+                if (!ok || !status.ok() || !reply.ok()) {
+                    std::cerr << "Conditional WriteProp to " << replicas_[idx].address
+                              << " failed for PUT " << key << ": "
+                              << (status.ok() ? "NOK Ack or stream not ok"
+                                              : status.error_message())
+                              << "\n";
+                    return;
+                }
+                replied++;
+                if (reply.applied()) {
+                    applied++;
+                } else if (TagGreater(reply.current_tag(), max_tag)) {
+                    max_tag = reply.current_tag();
+                }
+            },
+            // stop once it's applied, or once it can't be and we have a quorum's tags
+            [&] { return applied >= W_ || (replied >= R_ && replied - applied > N_ - W_); });
+
+        req.set_conditional(false);
+        have_max = replied >= R_;
+        return applied >= W_;
+    }
+
+    // Sends write_prop_->request() (already filled in) to every replica, returns #acks
+    // once `quorum` of them have acked or everyone has answered
+    int WritePropRound(const std::string& key, int quorum, bool write_back)
+    {
+        int ack_count = 0;
+        write_prop_->Begin();
+        for (int i = 0; i < N_; ++i) {
+            write_prop_->Add(i, replicas_[i].generic_stub.get());
+        }
+        write_prop_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::Ack& reply) {
+                if (!ok || !status.ok() || !reply.ok()) {
+                    std::cerr << (write_back ? "WriteProp (read write-back) to " : "WriteProp to ")
+                              << replicas_[idx].address
+                              << " failed for " << (write_back ? "GET " : "PUT ") << key << ": "
+                              << (status.ok() ? "NOK Ack or stream not ok"
+                                              : status.error_message())
+                              << "\n";
+                    return;
+                }
+                ack_count++;
+            },
+            [&] { return ack_count >= quorum; });
+        return ack_count;
+    }
+
+    std::vector<Replica> replicas_;
+    int N_ = 0;
+    int R_ = 0;
+    int W_ = 0;
+    std::string client_id_;
+    bool verbose_ = true;
+    NearCache near_cache_;
+    std::shared_ptr<SingleWriterTags> owned_; // shared with the other clients of the process
+    bool optimistic_ = false;
+    long one_round_puts_ = 0;
+    bool coordinated_ = false;
+    int coordinator_ = 0;
+    uint32_t generation_ = 0; // 0 until SetGeneration: unversioned
+    abd::Tag last_tag_;
+
+    // one reusable round per phase type (see QuorumCall.h)
+    std::unique_ptr<WriteQueryCall> write_query_;
+    std::unique_ptr<ReadQueryCall> read_query_;
+    std::unique_ptr<WritePropCall> write_prop_;
+};
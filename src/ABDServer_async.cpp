@@ -1,17 +1,32 @@
 #include "proto/abd.grpc.pb.h"
 #include "proto/abd.pb.h"
+#include "src/ABDClient_async.h"
+#include "src/ClientCommon.h"
+#include "src/TimerWheel.h"
+#include "src/WorkStealingPool.h"
+#include <grpcpp/alarm.h>
 #include <grpcpp/grpcpp.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <unordered_map>
 #include <mutex>
 #include <memory>
+#include <thread>
+#include <vector>
 
 // Simple struct to hold (tag, value) per key
 struct Entry {
     abd::Tag tag;
     std::string value;
+    bool settled = false; // tag is known to be on a write quorum, see SettleEntry
+    uint64_t fence = 0;   // newest lock epoch a WriteProp carried, see ApplyWriteProp
 };
 
 // Forward-declare helper for tag comparison
@@ -21,10 +36,185 @@ static bool TagGreater(const abd::Tag& a, const abd::Tag& b) {
     return a.client_id() > b.client_id();
 }
 
+// ReadQuery body (mu held), also behind AcquireAndQuery. A writer only wants the tag.
+static void QueryEntry(const std::unordered_map<std::string, Entry>& table, const std::string& key,
+                       const abd::Tag* cached_tag, bool want_value, abd::ReadQueryReply& reply) {
+    auto it = table.find(key);
+    abd::Tag* t = reply.mutable_tag();
+    if (it == table.end()) {
+        t->set_counter(0);
+        t->set_client_id("");
+    } else {
+        *t = it->second.tag;
+        reply.set_settled(it->second.settled);
+    }
+    // client already holds this version (or a newer one), skip the value. A key we don't
+    // have is tag 0, which is never newer than a cached copy: saying "modified" with an
+    // empty value would have the client take "" over what it knows.
+    if (cached_tag && !TagGreater(*t, *cached_tag)) {
+        reply.set_not_modified(true);
+    } else if (want_value && it != table.end()) {
+        reply.set_value(it->second.value);
+    }
+}
+
+// WriteProp body (mu held), also behind PropAndRelease.
+// Fenced writes (lock coordinator mode) carry the epoch of the writer's lock. One older
+// than an epoch we've already seen for the key is from a holder whose lease ran out while
+// someone newer got the lock and wrote here: refused, whatever its tag.
+static void ApplyWriteProp(std::unordered_map<std::string, Entry>& table, const abd::WritePropRequest& req,
+                           abd::Ack& reply) {
+    const abd::Tag& incoming = req.tag();
+    auto it = table.find(req.key());
+    if (req.fence() > 0 && it != table.end()) {
+        if (req.fence() < it->second.fence) {
+            reply.set_ok(false);
+            reply.set_fenced(true);
+            reply.set_error("fenced: lock epoch " + std::to_string(req.fence()) + " < " +
+                            std::to_string(it->second.fence));
+            return;
+        }
+        it->second.fence = req.fence();
+    }
+    if (it == table.end()) {
+        Entry entry;
+        entry.tag = incoming;
+        entry.value = req.value();
+        entry.fence = req.fence();
+        table[req.key()] = std::move(entry);
+        reply.set_applied(true);
+    } else {
+        abd::Tag& current = it->second.tag;
+        if (TagGreater(incoming, current)) {
+            it->second.tag = incoming;
+            it->second.value = req.value();
+            it->second.settled = false;
+            reply.set_applied(true);
+        } else if (req.conditional()) {
+            *reply.mutable_current_tag() = current;
+        }
+    }
+    reply.set_ok(true);
+    reply.set_error("");
+}
+
+// A blocking client's PUT got W acks for `tag` and says so in its ReleaseLock. If that's
+// still what we have, readers who get it from us can skip their write-back: it is on a
+// write quorum already, so every later read quorum overlaps a replica with it (or newer).
+static void SettleEntry(std::unordered_map<std::string, Entry>& table, const std::string& key,
+                        const abd::Tag& tag) {
+    auto it = table.find(key);
+    if (it == table.end()) return;
+    if (it->second.tag.counter() == tag.counter() && it->second.tag.client_id() == tag.client_id()) {
+        it->second.settled = true;
+    }
+}
+
+// ABD requests carry the sender's generation of our group (servers.conf). Once a migration
+// has retired the generations below min_generation (RetireRequest), a request for one of
+// them is from a client that never saw the new configuration: it fails, rather than
+// writing where nobody reads any more. 0 is unversioned (clients that don't migrate).
+static grpc::Status CheckGeneration(uint32_t generation, const std::atomic<uint32_t>& min_generation) {
+    const uint32_t min = min_generation.load();
+    if (generation == 0 || generation >= min) return grpc::Status::OK;
+    return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                        "group generation " + std::to_string(generation) + " is retired here (now " +
+                            std::to_string(min) + "), reload servers.conf");
+}
+
+// A multi-key lock request's keys in the order everyone takes them: sorted, once each
+static std::vector<std::string> SortedKeys(const google::protobuf::RepeatedPtrField<std::string>& keys) {
+    std::vector<std::string> sorted(keys.begin(), keys.end());
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    return sorted;
+}
+
+// Erasure-coded (CAS) mode: this replica's fragment of each version of a key, kept apart
+// from the ABD table. A version is "pre" until a writer (or a reader) finalizes it.
+struct CasVersion {
+    abd::Tag tag;
+    std::string fragment;
+    uint32_t value_size = 0;
+    bool has_fragment = false;
+    bool finalized = false;
+};
+using CasVersions = std::vector<CasVersion>;
+
+// CASGC: only the delta + 1 newest finalized versions (and whatever is newer than them)
+// keep anything. A read can only want an older one if more than delta writes ran
+// concurrently with it, and then it fails instead of returning something stale.
+static void CasCollect(CasVersions& versions, int delta) {
+    std::vector<const abd::Tag*> fin;
+    for (const auto& v : versions) {
+        if (v.finalized) fin.push_back(&v.tag);
+    }
+    if (static_cast<int>(fin.size()) <= delta + 1) return;
+    std::nth_element(fin.begin(), fin.begin() + delta, fin.end(),
+                     [](const abd::Tag* a, const abd::Tag* b) { return TagGreater(*a, *b); });
+    const abd::Tag cutoff = *fin[delta];
+    versions.erase(std::remove_if(versions.begin(), versions.end(),
+                                  [&](const CasVersion& v) { return TagGreater(cutoff, v.tag); }),
+                   versions.end());
+}
+
+static CasVersion& CasFind(CasVersions& versions, const abd::Tag& tag) {
+    for (auto& v : versions) {
+        if (v.tag.counter() == tag.counter() && v.tag.client_id() == tag.client_id()) return v;
+    }
+    versions.emplace_back();
+    versions.back().tag = tag;
+    return versions.back();
+}
+
+// Coordinator mode (--peers): CoordinatedPut/Get run the ABD phases for the client from
+// here, over channels to the rest of our group that stay open for the server's lifetime.
+// ABDClient blocks on its rounds, so ops go to a few worker threads, each with its own
+// client (and client_id, these are separate writers as far as tags go); the CQ thread only
+// hands them off.
+class Coordinator {
+public:
+    Coordinator(const ServerGroup& group, const QuorumConfig& quorums, const std::string& self, int threads)
+        : pool_(threads)
+    {
+        auto channels = CreateChannels(group.addrs);
+        for (int w = 0; w < pool_.NumWorkers(); ++w) {
+            clients_.emplace_back(new ABDClient(group.addrs, channels, "coord-" + self + "-" + std::to_string(w)));
+            clients_.back()->SetVerbose(false);
+            clients_.back()->SetQuorums(quorums.R, quorums.W);
+            clients_.back()->SetGeneration(group.generation);
+        }
+    }
+
+    void Submit(std::function<void(ABDClient&)> op)
+    {
+        pool_.Submit([this, op](int worker) { op(*clients_[worker]); });
+    }
+
+private:
+    std::vector<std::unique_ptr<ABDClient>> clients_;
+    WorkStealingPool pool_; // last, so its threads are joined before the clients go
+};
+
+// Who goes first when readers and writers queue for the same lock, see LockTable
+enum class LockPreference { FIFO, WRITERS, READERS };
+
 class ABDServer {
 public:
-    explicit ABDServer(const std::string& server_address)
-        : server_address_(server_address) {}
+    // coordinator may be null: Coordinated* RPCs then fail with FAILED_PRECONDITION.
+    // cas_delta: concurrent writes a CAS read tolerates (see CasCollect)
+    // lease_ms: how long a lock lasts unless the client asks for something else
+    explicit ABDServer(const std::string& server_address, std::unique_ptr<Coordinator> coordinator = nullptr,
+                       int cas_delta = 2, int lease_ms = 2000,
+                       LockPreference lock_preference = LockPreference::FIFO)
+        : server_address_(server_address), coordinator_(std::move(coordinator)), cas_delta_(cas_delta) {
+        lock_table_.default_lease = std::chrono::milliseconds(lease_ms);
+        lock_table_.preference = lock_preference;
+        // epochs must keep going up across a restart, which forgets every lock
+        lock_table_.next_epoch = std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count();
+    }
 
     void Run() {
         grpc::ServerBuilder builder;
@@ -37,13 +227,31 @@ public:
         std::cout << "Async ABDServer listening on " << server_address_ << std::endl;
 
         // Kick off a CallData instance for each RPC type
-        new WriteQueryCallData(&service_, cq_.get(), &table_, &mu_);
-        new ReadQueryCallData(&service_, cq_.get(), &table_, &mu_);
-        new WritePropCallData(&service_, cq_.get(), &table_, &mu_);
+        new WriteQueryCallData(&service_, cq_.get(), &table_, &lock_table_, &mu_, &min_generation_);
+        new ReadQueryCallData(&service_, cq_.get(), &table_, &lock_table_, &mu_, &min_generation_);
+        new WritePropCallData(&service_, cq_.get(), &table_, &mu_, &min_generation_);
 
         // NEW: lock RPC handlers
         new AcquireLockCallData(&service_, cq_.get(), &lock_table_, &mu_);
-        new ReleaseLockCallData(&service_, cq_.get(), &lock_table_, &mu_);
+        new ReleaseLockCallData(&service_, cq_.get(), &table_, &lock_table_, &mu_);
+        new AcquireAndQueryCallData(&service_, cq_.get(), &table_, &lock_table_, &mu_);
+        new PropAndReleaseCallData(&service_, cq_.get(), &table_, &lock_table_, &mu_);
+        new AcquireLocksCallData(&service_, cq_.get(), &lock_table_, &mu_);
+        new ReleaseLocksCallData(&service_, cq_.get(), &table_, &lock_table_, &mu_);
+        new LeaseTickerCallData(cq_.get(), &lock_table_, &mu_, server_address_);
+
+        // migration support
+        new ScanCallData(&service_, cq_.get(), &table_, &mu_, &min_generation_);
+        new RetireCallData(&service_, cq_.get(), &min_generation_, server_address_);
+
+        // coordinator mode
+        new CoordinatedPutCallData(&service_, cq_.get(), coordinator_.get(), &min_generation_);
+        new CoordinatedGetCallData(&service_, cq_.get(), coordinator_.get(), &min_generation_);
+
+        // erasure-coded mode
+        new CasQueryCallData(&service_, cq_.get(), &cas_table_, &mu_);
+        new CasPreWriteCallData(&service_, cq_.get(), &cas_table_, &mu_, cas_delta_);
+        new CasFinalizeCallData(&service_, cq_.get(), &cas_table_, &mu_, cas_delta_);
 
         void* tag;
         bool ok;
@@ -61,19 +269,395 @@ private:
         virtual void Proceed(bool ok) = 0;
     };
 
+    // A call parked in a key's lock queue: AcquireLock, or AcquireAndQuery
+    class LockWaiter {
+    public:
+        virtual ~LockWaiter() = default;
+        virtual const abd::AcquireLockRequest& LockRequest() const = 0;
+        // Called (with mu held) by whoever takes us off the queue: a release or expiry
+        // handing us the lock, or our own client withdrawing
+        virtual void Wake(bool granted, const std::string& holder, uint32_t lease_ms, uint64_t fence) = 0;
+    };
+
+    // One client's hold on a key's lock
+    struct Holder {
+        std::string client;
+        uint64_t seq = 0;   // the attempt that got it, so a stale cancel can't release a newer one
+        uint64_t lease = 0; // id of this hold's lease
+        std::chrono::steady_clock::time_point expires;
+    };
+
+    // Lock of one key: who holds it (one client, or any number of SHARED ones), who is
+    // queued for it (parked calls, FIFO), and acquire attempts their clients withdrew
+    // before they arrived (client -> seq)
+    struct LockState {
+        std::vector<Holder> holders;
+        bool shared = false; // mode of the current holders
+        bool wanted = false; // someone was refused or queued since it was last free
+        uint64_t epoch = 0;  // of the current holders (SHARED ones that join share it)
+        std::deque<LockWaiter*> waiters;
+        std::unordered_map<std::string, uint64_t> cancelled;
+
+        bool Idle() const { return holders.empty() && waiters.empty() && cancelled.empty(); }
+
+        std::vector<Holder>::iterator Find(const std::string& client) {
+            return std::find_if(holders.begin(), holders.end(), [&](const Holder& h) { return h.client == client; });
+        }
+
+        // for replies: someone who has it
+        std::string AnyHolder() const { return holders.empty() ? "" : holders.front().client; }
+
+        bool ExclusiveWaiting() const {
+            return std::any_of(waiters.begin(), waiters.end(),
+                               [](const LockWaiter* w) { return w->LockRequest().mode() == abd::EXCLUSIVE; });
+        }
+    };
+
+    // what the wheel holds per lease; stale once the key's lease id moved on
+    struct LeaseRef {
+        std::string key;
+        uint64_t lease;
+    };
+
+    // Every hold is a lease: it lapses lease_ms after it was granted or last renewed (the
+    // holder renews by acquiring again) unless released before. A crashed or stalled
+    // client holds a key up for one lease at most. Renewals only move `expires`; the
+    // wheel entry notices when it comes up and goes back in for the rest. A grant to a
+    // free lock also starts a new epoch, the fencing token clients in lock coordinator
+    // mode put on their writes (see ApplyWriteProp).
+    //
+    // SHARED holds (GETs) go together, EXCLUSIVE ones (PUTs) alone. Who gets in while
+    // others queue is `preference`:
+    //   FIFO     a reader joins current readers only if nobody is queued; hand-offs go in
+    //            queue order, the readers at the front all at once
+    //   WRITERS  a reader joins unless a writer is queued; hand-offs go to writers first
+    //   READERS  a reader joins any time readers hold it; hand-offs go to readers first
+    struct LockTable {
+        using Clock = std::chrono::steady_clock;
+
+        std::unordered_map<std::string, LockState> locks;
+        TimerWheel<LeaseRef> wheel{std::chrono::milliseconds(10), 512};
+        std::chrono::milliseconds default_lease{2000};
+        LockPreference preference = LockPreference::FIFO;
+        uint64_t next_lease = 0;
+        uint64_t next_epoch = 0; // fencing tokens; ABDServer starts it at the wall clock (us)
+
+        // counters, printed by LeaseTickerCallData
+        long granted = 0;
+        long renewed = 0;
+        long released = 0;
+        long expired = 0;
+
+        std::chrono::milliseconds LeaseFor(uint32_t asked) const {
+            return asked ? std::chrono::milliseconds(asked) : default_lease;
+        }
+
+        // new hold (and lease) for req's client; returns the lease length for the reply
+        uint32_t Grant(LockState& st, const std::string& key, const abd::AcquireLockRequest& req) {
+            const auto len = LeaseFor(req.lease_ms());
+            Holder h;
+            h.client = req.client_id();
+            h.seq = req.seq();
+            h.lease = ++next_lease;
+            h.expires = Clock::now() + len;
+            wheel.Schedule(h.expires, LeaseRef{key, h.lease});
+            if (st.holders.empty()) st.epoch = ++next_epoch;
+            st.shared = req.mode() == abd::SHARED;
+            st.holders.push_back(std::move(h));
+            granted++;
+            return static_cast<uint32_t>(len.count());
+        }
+
+        uint32_t Renew(Holder& h, const std::string& key, const abd::AcquireLockRequest& req) {
+            const auto len = LeaseFor(req.lease_ms());
+            const auto expires = Clock::now() + len;
+            // shorter than before: the existing entry would come up too late
+            if (expires < h.expires) wheel.Schedule(expires, LeaseRef{key, h.lease});
+            h.expires = expires;
+            h.seq = std::max(h.seq, req.seq());
+            renewed++;
+            return static_cast<uint32_t>(len.count());
+        }
+
+        // can req's client get it right now, next to whoever holds it?
+        bool Compatible(const LockState& st, const abd::AcquireLockRequest& req) const {
+            if (st.holders.empty()) return true;
+            if (req.mode() != abd::SHARED || !st.shared) return false;
+            switch (preference) {
+            case LockPreference::FIFO: return st.waiters.empty();
+            case LockPreference::WRITERS: return !st.ExclusiveWaiting();
+            case LockPreference::READERS: return true;
+            }
+            return false;
+        }
+
+        void WakeGranted(LockState& st, const std::string& key, LockWaiter* w) {
+            uint32_t len = Grant(st, key, w->LockRequest());
+            w->Wake(true, w->LockRequest().client_id(), len, st.epoch);
+        }
+
+        // the last hold just went: whoever is next in line gets it (see `preference`)
+        void HandOff(LockState& st, const std::string& key) {
+            if (!st.holders.empty()) return;
+            st.wanted = false;
+            if (st.waiters.empty()) return;
+            auto first = st.waiters.begin();
+            if (preference != LockPreference::FIFO) {
+                const abd::LockMode want =
+                    preference == LockPreference::WRITERS ? abd::EXCLUSIVE : abd::SHARED;
+                auto it = std::find_if(st.waiters.begin(), st.waiters.end(),
+                                       [&](const LockWaiter* w) { return w->LockRequest().mode() == want; });
+                if (it != st.waiters.end()) first = it;
+            }
+            LockWaiter* next = *first;
+            st.waiters.erase(first);
+            WakeGranted(st, key, next);
+            if (!st.shared) return;
+            // a reader: the other readers that may come along do
+            for (auto w = st.waiters.begin(); w != st.waiters.end();) {
+                if ((*w)->LockRequest().mode() == abd::SHARED) {
+                    LockWaiter* reader = *w;
+                    w = st.waiters.erase(w);
+                    WakeGranted(st, key, reader);
+                } else if (preference == LockPreference::FIFO) {
+                    break;
+                } else {
+                    ++w;
+                }
+            }
+        }
+
+        enum AcquireResult { GRANTED, REFUSED, PARKED };
+
+        // Free, or compatible with the holders: granted, as a new lease. Already ours:
+        // granted, lease renewed. Otherwise refused, or with wait_ms set, `waiter` goes to
+        // the back of the queue (PARKED, reply left alone) until HandOff or GiveUp takes
+        // it off.
+        AcquireResult Acquire(const abd::AcquireLockRequest& req, LockWaiter* waiter,
+                              abd::AcquireLockReply& reply) {
+            const std::string& client_id = req.client_id();
+            LockState& st = locks[req.key()];
+
+            // withdrawn before it got here (see Release's cancel_seq)
+            auto c = st.cancelled.find(client_id);
+            bool withdrawn = false;
+            if (c != st.cancelled.end()) {
+                withdrawn = c->second >= req.seq();
+                st.cancelled.erase(c);
+            }
+
+            reply.set_holder(st.AnyHolder());
+            if (withdrawn) {
+                reply.set_granted(false);
+                if (st.Idle()) locks.erase(req.key());
+                return REFUSED;
+            }
+            auto self = st.Find(client_id);
+            if (self != st.holders.end()) {
+                // re-entrant by the same client: that's how a lease is renewed. Going from
+                // shared to exclusive only works if nobody else shares it (and we'd wait on
+                // ourselves if we queued for it)
+                if (req.mode() == abd::EXCLUSIVE && st.shared) {
+                    if (st.holders.size() > 1) {
+                        reply.set_granted(false);
+                        st.wanted = true;
+                        return REFUSED;
+                    }
+                    st.shared = false;
+                    st.epoch = ++next_epoch; // fences off our own shared-mode writes
+                }
+                reply.set_lease_ms(Renew(*self, req.key(), req));
+            } else if (Compatible(st, req)) {
+                reply.set_lease_ms(Grant(st, req.key(), req));
+            } else if (req.wait_ms() > 0) {
+                st.waiters.push_back(waiter);
+                st.wanted = true;
+                return PARKED;
+            } else {
+                // Held by someone else
+                reply.set_granted(false);
+                st.wanted = true;
+                return REFUSED;
+            }
+            reply.set_granted(true);
+            reply.set_holder(client_id);
+            reply.set_fence(st.epoch);
+            return GRANTED;
+        }
+
+        // Multi-key: every key in `keys` (sorted, no duplicates) for req's client, or none of
+        // them. Each key goes as Acquire would take it on its own, except that a batch never
+        // queues: a key that would park or be refused fails the whole batch, and the reply
+        // names it. Nothing is held while a batch waits, so batches can't deadlock with each
+        // other or with single-key waiters on this replica. A withdrawal (cancel_seq) of any
+        // of the keys withdraws the batch.
+        AcquireResult AcquireAll(const abd::AcquireLockRequest& req, const std::vector<std::string>& keys,
+                                 abd::AcquireLocksReply& reply) {
+            const std::string& client_id = req.client_id();
+            abd::AcquireLockReply& lock = *reply.mutable_lock();
+            bool withdrawn = false;
+            for (const std::string& key : keys) {
+                auto it = locks.find(key);
+                if (it == locks.end()) continue;
+                auto c = it->second.cancelled.find(client_id);
+                if (c == it->second.cancelled.end()) continue;
+                withdrawn = withdrawn || c->second >= req.seq();
+                it->second.cancelled.erase(c);
+                if (it->second.Idle()) locks.erase(it);
+            }
+            if (withdrawn) {
+                lock.set_granted(false);
+                return REFUSED;
+            }
+
+            // first pass: all of them ours to have?
+            for (const std::string& key : keys) {
+                auto it = locks.find(key);
+                if (it == locks.end()) continue;
+                LockState& st = it->second;
+                auto self = st.Find(client_id);
+                const bool ok = self != st.holders.end()
+                                    ? !(req.mode() == abd::EXCLUSIVE && st.shared && st.holders.size() > 1)
+                                    : Compatible(st, req);
+                if (!ok) {
+                    st.wanted = true;
+                    lock.set_granted(false);
+                    lock.set_holder(st.AnyHolder());
+                    reply.set_blocked_key(key);
+                    return REFUSED;
+                }
+            }
+
+            uint32_t lease_ms = 0;
+            for (const std::string& key : keys) {
+                LockState& st = locks[key];
+                auto self = st.Find(client_id);
+                if (self != st.holders.end()) {
+                    if (req.mode() == abd::EXCLUSIVE) st.shared = false;
+                    lease_ms = Renew(*self, key, req);
+                } else {
+                    lease_ms = Grant(st, key, req);
+                }
+            }
+            lock.set_granted(true);
+            lock.set_holder(client_id);
+            lock.set_lease_ms(lease_ms);
+            return GRANTED;
+        }
+
+        // Has anyone but the holders asked for this lock since it was last free? Answered
+        // on every query phase, so a client keeping the lock between ops (lock session)
+        // hears about it on its next op and lets go.
+        bool Wanted(const std::string& key) const {
+            auto it = locks.find(key);
+            return it != locks.end() && (it->second.wanted || !it->second.waiters.empty());
+        }
+
+        // a parked waiter's deadline passed: off the queue; returns who holds the lock now
+        std::string GiveUp(const std::string& key, LockWaiter* waiter) {
+            auto it = locks.find(key);
+            LockState& st = it->second;
+            st.waiters.erase(std::find(st.waiters.begin(), st.waiters.end(), waiter));
+            std::string holder = st.AnyHolder();
+            if (st.Idle()) locks.erase(it);
+            return holder;
+        }
+
+        // Drops the caller's hold, if it has one, and hands the lock on if that was the
+        // last. With cancel_seq it also withdraws the caller's acquire attempts up to that
+        // number: queued ones are answered "not granted", and one that hasn't arrived yet
+        // is remembered so it gets refused when it does (the client may cancel before we
+        // ever see it). Returns ReleaseLockReply.ok.
+        bool Release(const abd::ReleaseLockRequest& req) {
+            const std::string& client_id = req.client_id();
+            auto it = locks.find(req.key());
+            bool freed = false;
+            bool withdrew = false;
+
+            if (it != locks.end()) {
+                LockState& st = it->second;
+                if (req.cancel_seq() > 0) {
+                    for (auto w = st.waiters.begin(); w != st.waiters.end();) {
+                        const abd::AcquireLockRequest& acq = (*w)->LockRequest();
+                        if (acq.client_id() == client_id && acq.seq() <= req.cancel_seq()) {
+                            (*w)->Wake(false, st.AnyHolder(), 0, 0);
+                            w = st.waiters.erase(w);
+                            withdrew = true;
+                        } else {
+                            ++w;
+                        }
+                    }
+                }
+                auto h = st.Find(client_id);
+                if (h != st.holders.end() && (req.cancel_seq() == 0 || h->seq <= req.cancel_seq())) {
+                    // Only a holder may release; next in line gets it once nobody holds it
+                    st.holders.erase(h);
+                    released++;
+                    freed = true;
+                    HandOff(st, req.key());
+                }
+            }
+            if (req.cancel_seq() > 0 && !freed && !withdrew) {
+                uint64_t& memo = locks[req.key()].cancelled[client_id];
+                memo = std::max<uint64_t>(memo, req.cancel_seq());
+            }
+            it = locks.find(req.key());
+            if (it != locks.end() && it->second.Idle()) locks.erase(it);
+
+            // a withdrawal always succeeds; otherwise no lock, wrong client, or our lease
+            // ran out: treat as failure
+            return req.cancel_seq() > 0 || freed;
+        }
+
+        // Release of each key in turn; true if every one of them was ours (or, with
+        // cancel_seq, always, as for Release)
+        bool ReleaseAll(const abd::ReleaseLockRequest& req, const std::vector<std::string>& keys) {
+            abd::ReleaseLockRequest one = req;
+            bool ok = true;
+            for (const std::string& key : keys) {
+                one.set_key(key);
+                ok = Release(one) && ok;
+            }
+            return ok;
+        }
+
+        void Expire(Clock::time_point now) {
+            wheel.Advance(now, [&](LeaseRef& ref) {
+                auto it = locks.find(ref.key);
+                if (it == locks.end()) return;
+                LockState& st = it->second;
+                auto h = std::find_if(st.holders.begin(), st.holders.end(),
+                                      [&](const Holder& x) { return x.lease == ref.lease; });
+                if (h == st.holders.end()) return; // released since
+                if (h->expires > now) {
+                    wheel.Schedule(h->expires, std::move(ref)); // renewed since
+                    return;
+                }
+                expired++;
+                st.holders.erase(h);
+                HandOff(st, it->first);
+                if (st.Idle()) locks.erase(it);
+            });
+        }
+    };
+
     // ----- WriteQuery -----
     class WriteQueryCallData final : public CallData {
     public:
         WriteQueryCallData(abd::ABDService::AsyncService* service,
                            grpc::ServerCompletionQueue* cq,
                            std::unordered_map<std::string, Entry>* table,
-                           std::mutex* mu)
+                           const LockTable* lock_table,
+                           std::mutex* mu,
+                           const std::atomic<uint32_t>* min_generation)
             : service_(service),
               cq_(cq),
               responder_(&ctx_),
               status_(CREATE),
               table_(table),
-              mu_(mu) {
+              lock_table_(lock_table),
+              mu_(mu),
+              min_generation_(min_generation) {
             // Start the state machine
             Proceed(true);
         }
@@ -91,7 +675,14 @@ private:
                                             cq_, cq_, this);
             } else if (status_ == PROCESS) {
                 // Spawn a new CallData to serve the next client
-                new WriteQueryCallData(service_, cq_, table_, mu_);
+                new WriteQueryCallData(service_, cq_, table_, lock_table_, mu_, min_generation_);
+
+                status_ = FINISH;
+                grpc::Status gen = CheckGeneration(request_.generation(), *min_generation_);
+                if (!gen.ok()) {
+                    responder_.FinishWithError(gen, this);
+                    return;
+                }
 
                 // Build reply using shared ABD state
                 abd::WriteQueryReply reply;
@@ -106,9 +697,9 @@ private:
                     } else {
                         *reply.mutable_tag() = it->second.tag;
                     }
+                    reply.set_lock_wanted(lock_table_->Wanted(key));
                 }
 
-                status_ = FINISH;
                 responder_.Finish(reply, grpc::Status::OK, this);
             } else {
                 // FINISH
@@ -128,7 +719,9 @@ private:
         CallStatus status_;
 
         std::unordered_map<std::string, Entry>* table_;
+        const LockTable* lock_table_;
         std::mutex* mu_;
+        const std::atomic<uint32_t>* min_generation_;
     };
 
     // ----- ReadQuery -----
@@ -137,13 +730,17 @@ private:
         ReadQueryCallData(abd::ABDService::AsyncService* service,
                           grpc::ServerCompletionQueue* cq,
                           std::unordered_map<std::string, Entry>* table,
-                          std::mutex* mu)
+                          const LockTable* lock_table,
+                          std::mutex* mu,
+                          const std::atomic<uint32_t>* min_generation)
             : service_(service),
               cq_(cq),
               responder_(&ctx_),
               status_(CREATE),
               table_(table),
-              mu_(mu) {
+              lock_table_(lock_table),
+              mu_(mu),
+              min_generation_(min_generation) {
             Proceed(true);
         }
 
@@ -157,25 +754,23 @@ private:
                 service_->RequestReadQuery(&ctx_, &request_, &responder_,
                                            cq_, cq_, this);
             } else if (status_ == PROCESS) {
-                new ReadQueryCallData(service_, cq_, table_, mu_);
+                new ReadQueryCallData(service_, cq_, table_, lock_table_, mu_, min_generation_);
+
+                status_ = FINISH;
+                grpc::Status gen = CheckGeneration(request_.generation(), *min_generation_);
+                if (!gen.ok()) {
+                    responder_.FinishWithError(gen, this);
+                    return;
+                }
 
                 abd::ReadQueryReply reply;
                 {
                     std::lock_guard<std::mutex> lock(*mu_);
-                    const std::string& key = request_.key();
-                    auto it = table_->find(key);
-                    if (it == table_->end()) {
-                        abd::Tag* t = reply.mutable_tag();
-                        t->set_counter(0);
-                        t->set_client_id("");
-                        reply.set_value("");
-                    } else {
-                        *reply.mutable_tag() = it->second.tag;
-                        reply.set_value(it->second.value);
-                    }
+                    QueryEntry(*table_, request_.key(), request_.has_cached_tag() ? &request_.cached_tag() : nullptr,
+                               true, reply);
+                    reply.set_lock_wanted(lock_table_->Wanted(request_.key()));
                 }
 
-                status_ = FINISH;
                 responder_.Finish(reply, grpc::Status::OK, this);
             } else {
                 delete this;
@@ -194,22 +789,28 @@ private:
         CallStatus status_;
 
         std::unordered_map<std::string, Entry>* table_;
+        const LockTable* lock_table_;
         std::mutex* mu_;
+        const std::atomic<uint32_t>* min_generation_;
     };
 
-    // ----- WriteProp -----
-    class WritePropCallData final : public CallData {
+    // ----- Scan -----
+    // Pages of the table in key order for migration. Sorting the matching keys on every
+    // page is O(n log n) per call, fine for a rebalancing tool that runs once in a while.
+    class ScanCallData final : public CallData {
     public:
-        WritePropCallData(abd::ABDService::AsyncService* service,
-                          grpc::ServerCompletionQueue* cq,
-                          std::unordered_map<std::string, Entry>* table,
-                          std::mutex* mu)
+        ScanCallData(abd::ABDService::AsyncService* service,
+                     grpc::ServerCompletionQueue* cq,
+                     std::unordered_map<std::string, Entry>* table,
+                     std::mutex* mu,
+                     const std::atomic<uint32_t>* min_generation)
             : service_(service),
               cq_(cq),
               responder_(&ctx_),
               status_(CREATE),
               table_(table),
-              mu_(mu) {
+              mu_(mu),
+              min_generation_(min_generation) {
             Proceed(true);
         }
 
@@ -220,35 +821,41 @@ private:
 
             if (status_ == CREATE) {
                 status_ = PROCESS;
-                service_->RequestWriteProp(&ctx_, &request_, &responder_,
-                                           cq_, cq_, this);
+                service_->RequestScan(&ctx_, &request_, &responder_,
+                                      cq_, cq_, this);
             } else if (status_ == PROCESS) {
-                new WritePropCallData(service_, cq_, table_, mu_);
+                new ScanCallData(service_, cq_, table_, mu_, min_generation_);
 
-                abd::Ack reply;
+                status_ = FINISH;
+                grpc::Status gen = CheckGeneration(request_.generation(), *min_generation_);
+                if (!gen.ok()) {
+                    responder_.FinishWithError(gen, this);
+                    return;
+                }
+
+                abd::ScanReply reply;
                 {
                     std::lock_guard<std::mutex> lock(*mu_);
-                    const std::string& key = request_.key();
-                    const abd::Tag& incoming = request_.tag();
+                    const std::string& after = request_.after_key();
+                    size_t limit = request_.limit() ? request_.limit() : 256;
 
-                    auto it = table_->find(key);
-                    if (it == table_->end()) {
-                        Entry entry;
-                        entry.tag = incoming;
-                        entry.value = request_.value();
-                        (*table_)[key] = std::move(entry);
-                    } else {
-                        abd::Tag& current = it->second.tag;
-                        if (TagGreater(incoming, current)) {
-                            it->second.tag = incoming;
-                            it->second.value = request_.value();
-                        }
+                    std::vector<const std::string*> keys;
+                    for (const auto& kv : *table_) {
+                        if (kv.first > after) keys.push_back(&kv.first);
                     }
-                    reply.set_ok(true);
-                    reply.set_error("");
+                    size_t n = std::min(limit, keys.size());
+                    std::partial_sort(keys.begin(), keys.begin() + n, keys.end(),
+                                      [](const std::string* a, const std::string* b) { return *a < *b; });
+                    for (size_t i = 0; i < n; ++i) {
+                        const Entry& e = table_->at(*keys[i]);
+                        abd::ScanEntry* out = reply.add_entries();
+                        out->set_key(*keys[i]);
+                        *out->mutable_tag() = e.tag;
+                        out->set_value(e.value);
+                    }
+                    reply.set_done(n == keys.size());
                 }
 
-                status_ = FINISH;
                 responder_.Finish(reply, grpc::Status::OK, this);
             } else {
                 delete this;
@@ -260,29 +867,32 @@ private:
         grpc::ServerCompletionQueue* cq_;
         grpc::ServerContext ctx_;
 
-        abd::WritePropRequest request_;
-        grpc::ServerAsyncResponseWriter<abd::Ack> responder_;
+        abd::ScanRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::ScanReply> responder_;
 
         enum CallStatus { CREATE, PROCESS, FINISH };
         CallStatus status_;
 
         std::unordered_map<std::string, Entry>* table_;
         std::mutex* mu_;
+        const std::atomic<uint32_t>* min_generation_;
     };
 
-    // ----- AcquireLock -----
-    class AcquireLockCallData final : public CallData {
+    // ----- Retire -----
+    // End of a migration (Migrator::RetireOld): generations below the new one stop being
+    // served, see CheckGeneration. Only ever goes up.
+    class RetireCallData final : public CallData {
     public:
-        AcquireLockCallData(abd::ABDService::AsyncService* service,
-                            grpc::ServerCompletionQueue* cq,
-                            std::unordered_map<std::string, std::string>* lock_table,
-                            std::mutex* mu)
+        RetireCallData(abd::ABDService::AsyncService* service,
+                       grpc::ServerCompletionQueue* cq,
+                       std::atomic<uint32_t>* min_generation,
+                       const std::string& address)
             : service_(service),
               cq_(cq),
               responder_(&ctx_),
               status_(CREATE),
-              lock_table_(lock_table),
-              mu_(mu) {
+              min_generation_(min_generation),
+              address_(address) {
             Proceed(true);
         }
 
@@ -293,34 +903,19 @@ private:
 
             if (status_ == CREATE) {
                 status_ = PROCESS;
-                service_->RequestAcquireLock(&ctx_, &request_, &responder_,
-                                             cq_, cq_, this);
+                service_->RequestRetire(&ctx_, &request_, &responder_,
+                                        cq_, cq_, this);
             } else if (status_ == PROCESS) {
-                // Spawn next handler
-                new AcquireLockCallData(service_, cq_, lock_table_, mu_);
+                new RetireCallData(service_, cq_, min_generation_, address_);
 
-                abd::AcquireLockReply reply;
-                {
-                    std::lock_guard<std::mutex> lock(*mu_);
-                    const std::string& key = request_.key();
-                    const std::string& client_id = request_.client_id();
-
-                    auto it = lock_table_->find(key);
-                    if (it == lock_table_->end() || it->second.empty()) {
-                        // No one holds the lock: grant to this client
-                        (*lock_table_)[key] = client_id;
-                        reply.set_granted(true);
-                        reply.set_holder(client_id);
-                    } else if (it->second == client_id) {
-                        // Re-entrant lock by same client: grant again
-                        reply.set_granted(true);
-                        reply.set_holder(client_id);
-                    } else {
-                        // Held by someone else
-                        reply.set_granted(false);
-                        reply.set_holder(it->second);
-                    }
+                // the CQ thread is the only writer
+                if (request_.generation() > min_generation_->load()) {
+                    min_generation_->store(request_.generation());
+                    std::cout << "[" << address_ << "] serving group generation "
+                              << request_.generation() << " and up from now on" << std::endl;
                 }
+                abd::Ack reply;
+                reply.set_ok(true);
 
                 status_ = FINISH;
                 responder_.Finish(reply, grpc::Status::OK, this);
@@ -334,29 +929,31 @@ private:
         grpc::ServerCompletionQueue* cq_;
         grpc::ServerContext ctx_;
 
-        abd::AcquireLockRequest request_;
-        grpc::ServerAsyncResponseWriter<abd::AcquireLockReply> responder_;
+        abd::RetireRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::Ack> responder_;
 
         enum CallStatus { CREATE, PROCESS, FINISH };
         CallStatus status_;
 
-        std::unordered_map<std::string, std::string>* lock_table_;
-        std::mutex* mu_;
+        std::atomic<uint32_t>* min_generation_;
+        std::string address_;
     };
 
-    // ----- ReleaseLock -----
-    class ReleaseLockCallData final : public CallData {
+    // ----- WriteProp -----
+    class WritePropCallData final : public CallData {
     public:
-        ReleaseLockCallData(abd::ABDService::AsyncService* service,
-                            grpc::ServerCompletionQueue* cq,
-                            std::unordered_map<std::string, std::string>* lock_table,
-                            std::mutex* mu)
+        WritePropCallData(abd::ABDService::AsyncService* service,
+                          grpc::ServerCompletionQueue* cq,
+                          std::unordered_map<std::string, Entry>* table,
+                          std::mutex* mu,
+                          const std::atomic<uint32_t>* min_generation)
             : service_(service),
               cq_(cq),
               responder_(&ctx_),
               status_(CREATE),
-              lock_table_(lock_table),
-              mu_(mu) {
+              table_(table),
+              mu_(mu),
+              min_generation_(min_generation) {
             Proceed(true);
         }
 
@@ -367,30 +964,24 @@ private:
 
             if (status_ == CREATE) {
                 status_ = PROCESS;
-                service_->RequestReleaseLock(&ctx_, &request_, &responder_,
-                                             cq_, cq_, this);
+                service_->RequestWriteProp(&ctx_, &request_, &responder_,
+                                           cq_, cq_, this);
             } else if (status_ == PROCESS) {
-                // Spawn next handler
-                new ReleaseLockCallData(service_, cq_, lock_table_, mu_);
+                new WritePropCallData(service_, cq_, table_, mu_, min_generation_);
 
-                abd::ReleaseLockReply reply;
+                status_ = FINISH;
+                grpc::Status gen = CheckGeneration(request_.generation(), *min_generation_);
+                if (!gen.ok()) {
+                    responder_.FinishWithError(gen, this);
+                    return;
+                }
+
+                abd::Ack reply;
                 {
                     std::lock_guard<std::mutex> lock(*mu_);
-                    const std::string& key = request_.key();
-                    const std::string& client_id = request_.client_id();
-
-                    auto it = lock_table_->find(key);
-                    if (it != lock_table_->end() && it->second == client_id) {
-                        // Only current holder may release
-                        lock_table_->erase(it);
-                        reply.set_ok(true);
-                    } else {
-                        // Either no lock or wrong client; treat as failure
-                        reply.set_ok(false);
-                    }
+                    ApplyWriteProp(*table_, request_, reply);
                 }
 
-                status_ = FINISH;
                 responder_.Finish(reply, grpc::Status::OK, this);
             } else {
                 delete this;
@@ -402,37 +993,973 @@ private:
         grpc::ServerCompletionQueue* cq_;
         grpc::ServerContext ctx_;
 
-        abd::ReleaseLockRequest request_;
-        grpc::ServerAsyncResponseWriter<abd::ReleaseLockReply> responder_;
+        abd::WritePropRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::Ack> responder_;
 
         enum CallStatus { CREATE, PROCESS, FINISH };
         CallStatus status_;
 
-        std::unordered_map<std::string, std::string>* lock_table_;
+        std::unordered_map<std::string, Entry>* table_;
         std::mutex* mu_;
+        const std::atomic<uint32_t>* min_generation_;
     };
 
-    std::string server_address_;
-    abd::ABDService::AsyncService service_;
-    std::unique_ptr<grpc::ServerCompletionQueue> cq_;
-    std::unique_ptr<grpc::Server> server_;
+    // ----- CoordinatedPut -----
+    // PROCESS hands the op to a coordinator worker, which calls Finish itself when done
+    class CoordinatedPutCallData final : public CallData {
+    public:
+        CoordinatedPutCallData(abd::ABDService::AsyncService* service,
+                               grpc::ServerCompletionQueue* cq,
+                               Coordinator* coordinator,
+                               const std::atomic<uint32_t>* min_generation)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              coordinator_(coordinator),
+              min_generation_(min_generation) {
+            Proceed(true);
+        }
 
-    std::mutex mu_;
-    std::unordered_map<std::string, Entry> table_;
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
 
-    // NEW: per-key lock owner (client_id) for blocking protocol
-    std::unordered_map<std::string, std::string> lock_table_;
-};
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestCoordinatedPut(&ctx_, &request_, &responder_,
+                                                cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new CoordinatedPutCallData(service_, cq_, coordinator_, min_generation_);
 
-int main(int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " <server_address>" << std::endl;
-        return 1;
-    }
+                status_ = FINISH;
+                if (!coordinator_) {
+                    responder_.FinishWithError(
+                        grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "server not started with --peers"), this);
+                    return;
+                }
+                grpc::Status gen = CheckGeneration(request_.generation(), *min_generation_);
+                if (!gen.ok()) {
+                    responder_.FinishWithError(gen, this);
+                    return;
+                }
+                coordinator_->Submit([this](ABDClient& client) {
+                    abd::CoordinatedReply reply;
+                    if (client.Put(request_.key(), request_.value())) {
+                        reply.set_ok(true);
+                        *reply.mutable_tag() = client.LastTag();
+                    } else {
+                        reply.set_error("no quorum for PUT " + request_.key());
+                    }
+                    responder_.Finish(reply, grpc::Status::OK, this);
+                });
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::CoordinatedPutRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::CoordinatedReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        Coordinator* coordinator_;
+        const std::atomic<uint32_t>* min_generation_;
+    };
 
-    std::string server_address = argv[1];
-    ABDServer server(server_address);
-    server.Run();
+    // ----- CoordinatedGet -----
+    class CoordinatedGetCallData final : public CallData {
+    public:
+        CoordinatedGetCallData(abd::ABDService::AsyncService* service,
+                               grpc::ServerCompletionQueue* cq,
+                               Coordinator* coordinator,
+                               const std::atomic<uint32_t>* min_generation)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              coordinator_(coordinator),
+              min_generation_(min_generation) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestCoordinatedGet(&ctx_, &request_, &responder_,
+                                                cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new CoordinatedGetCallData(service_, cq_, coordinator_, min_generation_);
+
+                status_ = FINISH;
+                if (!coordinator_) {
+                    responder_.FinishWithError(
+                        grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "server not started with --peers"), this);
+                    return;
+                }
+                grpc::Status gen = CheckGeneration(request_.generation(), *min_generation_);
+                if (!gen.ok()) {
+                    responder_.FinishWithError(gen, this);
+                    return;
+                }
+                coordinator_->Submit([this](ABDClient& client) {
+                    abd::CoordinatedReply reply;
+                    Consistency level = Consistency::LINEARIZABLE;
+                    if (request_.consistency() <= static_cast<uint32_t>(Consistency::ONE)) {
+                        level = static_cast<Consistency>(request_.consistency());
+                    }
+                    std::string value;
+                    if (client.Get(request_.key(), value, level)) {
+                        reply.set_ok(true);
+                        *reply.mutable_tag() = client.LastTag();
+                        reply.set_value(value);
+                    } else {
+                        reply.set_error("no quorum for GET " + request_.key());
+                    }
+                    responder_.Finish(reply, grpc::Status::OK, this);
+                });
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::CoordinatedGetRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::CoordinatedReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        Coordinator* coordinator_;
+        const std::atomic<uint32_t>* min_generation_;
+    };
+
+    // ----- CasQuery -----
+    class CasQueryCallData final : public CallData {
+    public:
+        CasQueryCallData(abd::ABDService::AsyncService* service,
+                         grpc::ServerCompletionQueue* cq,
+                         std::unordered_map<std::string, CasVersions>* cas_table,
+                         std::mutex* mu)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              cas_table_(cas_table),
+              mu_(mu) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestCasQuery(&ctx_, &request_, &responder_,
+                                          cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new CasQueryCallData(service_, cq_, cas_table_, mu_);
+
+                abd::CasQueryReply reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    abd::Tag* best = reply.mutable_tag();
+                    best->set_counter(0);
+                    best->set_client_id("");
+                    auto it = cas_table_->find(request_.key());
+                    if (it != cas_table_->end()) {
+                        for (const auto& v : it->second) {
+                            if (v.finalized && TagGreater(v.tag, *best)) *best = v.tag;
+                        }
+                    }
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::CasQueryRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::CasQueryReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        std::unordered_map<std::string, CasVersions>* cas_table_;
+        std::mutex* mu_;
+    };
+
+    // ----- CasPreWrite -----
+    class CasPreWriteCallData final : public CallData {
+    public:
+        CasPreWriteCallData(abd::ABDService::AsyncService* service,
+                            grpc::ServerCompletionQueue* cq,
+                            std::unordered_map<std::string, CasVersions>* cas_table,
+                            std::mutex* mu,
+                            int delta)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              cas_table_(cas_table),
+              mu_(mu),
+              delta_(delta) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestCasPreWrite(&ctx_, &request_, &responder_,
+                                             cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new CasPreWriteCallData(service_, cq_, cas_table_, mu_, delta_);
+
+                abd::Ack reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    CasVersions& versions = (*cas_table_)[request_.key()];
+                    CasVersion& v = CasFind(versions, request_.tag());
+                    // a finalize may have beaten us here, keep its label
+                    v.fragment = std::move(*request_.mutable_fragment());
+                    v.value_size = request_.value_size();
+                    v.has_fragment = true;
+                    CasCollect(versions, delta_);
+                    reply.set_ok(true);
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::CasPreWriteRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::Ack> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        std::unordered_map<std::string, CasVersions>* cas_table_;
+        std::mutex* mu_;
+        int delta_;
+    };
+
+    // ----- CasFinalize -----
+    class CasFinalizeCallData final : public CallData {
+    public:
+        CasFinalizeCallData(abd::ABDService::AsyncService* service,
+                            grpc::ServerCompletionQueue* cq,
+                            std::unordered_map<std::string, CasVersions>* cas_table,
+                            std::mutex* mu,
+                            int delta)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              cas_table_(cas_table),
+              mu_(mu),
+              delta_(delta) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestCasFinalize(&ctx_, &request_, &responder_,
+                                             cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new CasFinalizeCallData(service_, cq_, cas_table_, mu_, delta_);
+
+                abd::CasFinalizeReply reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    CasVersions& versions = (*cas_table_)[request_.key()];
+                    // no fragment yet (pre-write still on its way) still gets the label
+                    CasVersion& v = CasFind(versions, request_.tag());
+                    v.finalized = true;
+                    if (request_.want_fragment() && v.has_fragment) {
+                        reply.set_has_fragment(true);
+                        reply.set_fragment(v.fragment);
+                        reply.set_value_size(v.value_size);
+                    }
+                    CasCollect(versions, delta_);
+                    reply.set_ok(true);
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::CasFinalizeRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::CasFinalizeReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        std::unordered_map<std::string, CasVersions>* cas_table_;
+        std::mutex* mu_;
+        int delta_;
+    };
+
+    // ----- AcquireLock -----
+    // See LockTable::Acquire. A parked call finishes when HandOff or a withdrawal wakes
+    // it, or when its deadline alarm goes off, whichever comes first. Everything here runs
+    // on the CQ thread, so a parked call can't be woken and timed out at once.
+    class AcquireLockCallData final : public CallData, public LockWaiter {
+    public:
+        AcquireLockCallData(abd::ABDService::AsyncService* service,
+                            grpc::ServerCompletionQueue* cq,
+                            LockTable* lock_table,
+                            std::mutex* mu)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              lock_table_(lock_table),
+              mu_(mu) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (status_ == WOKEN) {
+                // the Finish and the (cancelled or already fired) alarm both come back here
+                if (--events_left_ == 0) delete this;
+                return;
+            }
+            if (status_ == PARKED) {
+                // deadline alarm; being woken first would have moved us to WOKEN
+                abd::AcquireLockReply reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    reply.set_holder(lock_table_->GiveUp(request_.key(), this));
+                }
+                reply.set_granted(false);
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+                return;
+            }
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestAcquireLock(&ctx_, &request_, &responder_,
+                                             cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                // Spawn next handler
+                new AcquireLockCallData(service_, cq_, lock_table_, mu_);
+
+                abd::AcquireLockReply reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    if (lock_table_->Acquire(request_, this, reply) == LockTable::PARKED) {
+                        status_ = PARKED;
+                        alarm_.Set(cq_, std::chrono::system_clock::now() + std::chrono::milliseconds(request_.wait_ms()),
+                                   this);
+                        return;
+                    }
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+        const abd::AcquireLockRequest& LockRequest() const override { return request_; }
+
+        void Wake(bool granted, const std::string& holder, uint32_t lease_ms, uint64_t fence) override {
+            abd::AcquireLockReply reply;
+            reply.set_granted(granted);
+            reply.set_holder(holder);
+            reply.set_lease_ms(lease_ms);
+            reply.set_fence(fence);
+            status_ = WOKEN;
+            events_left_ = 2;
+            alarm_.Cancel();
+            responder_.Finish(reply, grpc::Status::OK, this);
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::AcquireLockRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::AcquireLockReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, PARKED, WOKEN, FINISH };
+        CallStatus status_;
+        grpc::Alarm alarm_;
+        int events_left_ = 0;
+
+        LockTable* lock_table_;
+        std::mutex* mu_;
+    };
+
+    // ----- AcquireAndQuery -----
+    // AcquireLock and, if granted, ReadQuery (or just the tag, for a writer) in the same
+    // critical section, so a blocking client's first phase is one round trip. Parks like
+    // AcquireLock; the query then runs when the lock is handed over.
+    class AcquireAndQueryCallData final : public CallData, public LockWaiter {
+    public:
+        AcquireAndQueryCallData(abd::ABDService::AsyncService* service,
+                                grpc::ServerCompletionQueue* cq,
+                                std::unordered_map<std::string, Entry>* table,
+                                LockTable* lock_table,
+                                std::mutex* mu)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              table_(table),
+              lock_table_(lock_table),
+              mu_(mu) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (status_ == WOKEN) {
+                if (--events_left_ == 0) delete this;
+                return;
+            }
+            if (status_ == PARKED) {
+                abd::AcquireAndQueryReply reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    reply.mutable_lock()->set_holder(lock_table_->GiveUp(request_.lock().key(), this));
+                }
+                reply.mutable_lock()->set_granted(false);
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+                return;
+            }
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestAcquireAndQuery(&ctx_, &request_, &responder_,
+                                                 cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new AcquireAndQueryCallData(service_, cq_, table_, lock_table_, mu_);
+
+                abd::AcquireAndQueryReply reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    switch (lock_table_->Acquire(request_.lock(), this, *reply.mutable_lock())) {
+                    case LockTable::PARKED:
+                        status_ = PARKED;
+                        alarm_.Set(cq_, std::chrono::system_clock::now() +
+                                            std::chrono::milliseconds(request_.lock().wait_ms()),
+                                   this);
+                        return;
+                    case LockTable::GRANTED:
+                        Query(*reply.mutable_query());
+                        break;
+                    case LockTable::REFUSED:
+                        break;
+                    }
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+        const abd::AcquireLockRequest& LockRequest() const override { return request_.lock(); }
+
+        void Wake(bool granted, const std::string& holder, uint32_t lease_ms, uint64_t fence) override {
+            abd::AcquireAndQueryReply reply;
+            reply.mutable_lock()->set_granted(granted);
+            reply.mutable_lock()->set_holder(holder);
+            reply.mutable_lock()->set_lease_ms(lease_ms);
+            reply.mutable_lock()->set_fence(fence);
+            if (granted) Query(*reply.mutable_query()); // mu is held
+            status_ = WOKEN;
+            events_left_ = 2;
+            alarm_.Cancel();
+            responder_.Finish(reply, grpc::Status::OK, this);
+        }
+
+    private:
+        void Query(abd::ReadQueryReply& reply) {
+            QueryEntry(*table_, request_.lock().key(),
+                       request_.has_cached_tag() ? &request_.cached_tag() : nullptr,
+                       request_.want_value(), reply);
+        }
+
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::AcquireAndQueryRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::AcquireAndQueryReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, PARKED, WOKEN, FINISH };
+        CallStatus status_;
+        grpc::Alarm alarm_;
+        int events_left_ = 0;
+
+        std::unordered_map<std::string, Entry>* table_;
+        LockTable* lock_table_;
+        std::mutex* mu_;
+    };
+
+    // ----- ReleaseLock -----
+    // See LockTable::Release; a settled tag is recorded first (SettleEntry), whether or
+    // not we still hold the lock, it's a fact about the write either way
+    class ReleaseLockCallData final : public CallData {
+    public:
+        ReleaseLockCallData(abd::ABDService::AsyncService* service,
+                            grpc::ServerCompletionQueue* cq,
+                            std::unordered_map<std::string, Entry>* table,
+                            LockTable* lock_table,
+                            std::mutex* mu)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              table_(table),
+              lock_table_(lock_table),
+              mu_(mu) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestReleaseLock(&ctx_, &request_, &responder_,
+                                             cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                // Spawn next handler
+                new ReleaseLockCallData(service_, cq_, table_, lock_table_, mu_);
+
+                abd::ReleaseLockReply reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    if (request_.has_settled()) SettleEntry(*table_, request_.key(), request_.settled());
+                    reply.set_ok(lock_table_->Release(request_));
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::ReleaseLockRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::ReleaseLockReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        std::unordered_map<std::string, Entry>* table_;
+        LockTable* lock_table_;
+        std::mutex* mu_;
+    };
+
+    // ----- AcquireLocks / ReleaseLocks -----
+    // A multi-key transaction's locks on this replica, in one round trip each way (see
+    // LockTable::AcquireAll). Never parks, so no LockWaiter.
+    class AcquireLocksCallData final : public CallData {
+    public:
+        AcquireLocksCallData(abd::ABDService::AsyncService* service,
+                             grpc::ServerCompletionQueue* cq,
+                             LockTable* lock_table,
+                             std::mutex* mu)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              lock_table_(lock_table),
+              mu_(mu) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestAcquireLocks(&ctx_, &request_, &responder_,
+                                              cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new AcquireLocksCallData(service_, cq_, lock_table_, mu_);
+
+                abd::AcquireLocksReply reply;
+                std::vector<std::string> keys = SortedKeys(request_.keys());
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    lock_table_->AcquireAll(request_.lock(), keys, reply);
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::AcquireLocksRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::AcquireLocksReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        LockTable* lock_table_;
+        std::mutex* mu_;
+    };
+
+    class ReleaseLocksCallData final : public CallData {
+    public:
+        ReleaseLocksCallData(abd::ABDService::AsyncService* service,
+                             grpc::ServerCompletionQueue* cq,
+                             std::unordered_map<std::string, Entry>* table,
+                             LockTable* lock_table,
+                             std::mutex* mu)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              table_(table),
+              lock_table_(lock_table),
+              mu_(mu) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestReleaseLocks(&ctx_, &request_, &responder_,
+                                              cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new ReleaseLocksCallData(service_, cq_, table_, lock_table_, mu_);
+
+                abd::ReleaseLockReply reply;
+                std::vector<std::string> keys = SortedKeys(request_.keys());
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    // settled tags go with the keys as the client listed them
+                    for (int i = 0; i < request_.settled_size() && i < request_.keys_size(); ++i) {
+                        SettleEntry(*table_, request_.keys(i), request_.settled(i));
+                    }
+                    reply.set_ok(lock_table_->ReleaseAll(request_.lock(), keys));
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::ReleaseLocksRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::ReleaseLockReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        std::unordered_map<std::string, Entry>* table_;
+        LockTable* lock_table_;
+        std::mutex* mu_;
+    };
+
+    // ----- PropAndRelease -----
+    // WriteProp then ReleaseLock, under one hold of mu: a blocking client's last phase and
+    // its unlock in one round trip. The write is applied even if the lock is gone (lease
+    // ran out), it's an ordinary tagged ABD write either way.
+    class PropAndReleaseCallData final : public CallData {
+    public:
+        PropAndReleaseCallData(abd::ABDService::AsyncService* service,
+                               grpc::ServerCompletionQueue* cq,
+                               std::unordered_map<std::string, Entry>* table,
+                               LockTable* lock_table,
+                               std::mutex* mu)
+            : service_(service),
+              cq_(cq),
+              responder_(&ctx_),
+              status_(CREATE),
+              table_(table),
+              lock_table_(lock_table),
+              mu_(mu) {
+            Proceed(true);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok && status_ != FINISH) {
+                status_ = FINISH;
+            }
+
+            if (status_ == CREATE) {
+                status_ = PROCESS;
+                service_->RequestPropAndRelease(&ctx_, &request_, &responder_,
+                                                cq_, cq_, this);
+            } else if (status_ == PROCESS) {
+                new PropAndReleaseCallData(service_, cq_, table_, lock_table_, mu_);
+
+                abd::PropAndReleaseReply reply;
+                {
+                    std::lock_guard<std::mutex> lock(*mu_);
+                    ApplyWriteProp(*table_, request_.prop(), *reply.mutable_ack());
+                    abd::ReleaseLockRequest release;
+                    release.set_key(request_.prop().key());
+                    release.set_client_id(request_.client_id());
+                    reply.set_released(lock_table_->Release(release));
+                }
+
+                status_ = FINISH;
+                responder_.Finish(reply, grpc::Status::OK, this);
+            } else {
+                delete this;
+            }
+        }
+
+    private:
+        abd::ABDService::AsyncService* service_;
+        grpc::ServerCompletionQueue* cq_;
+        grpc::ServerContext ctx_;
+
+        abd::PropAndReleaseRequest request_;
+        grpc::ServerAsyncResponseWriter<abd::PropAndReleaseReply> responder_;
+
+        enum CallStatus { CREATE, PROCESS, FINISH };
+        CallStatus status_;
+
+        std::unordered_map<std::string, Entry>* table_;
+        LockTable* lock_table_;
+        std::mutex* mu_;
+    };
+
+    // ----- lease expiry -----
+    // Not an RPC: an alarm on the CQ, re-armed every wheel tick, that expires lapsed
+    // leases. Also prints the lock counters now and then if they moved, the expirations
+    // being the interesting part (each one is a client that crashed or stalled holding).
+    class LeaseTickerCallData final : public CallData {
+    public:
+        LeaseTickerCallData(grpc::ServerCompletionQueue* cq, LockTable* lock_table, std::mutex* mu,
+                            const std::string& name)
+            : cq_(cq), lock_table_(lock_table), mu_(mu), name_(name) {
+            Arm();
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok) {
+                delete this; // CQ shutting down
+                return;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            {
+                std::lock_guard<std::mutex> lock(*mu_);
+                lock_table_->Expire(now);
+                if (now >= next_report_) {
+                    Report();
+                    next_report_ = now + std::chrono::seconds(10);
+                }
+            }
+            Arm();
+        }
+
+    private:
+        void Arm() {
+            alarm_.Set(cq_, std::chrono::system_clock::now() + lock_table_->wheel.Tick(), this);
+        }
+
+        void Report() {
+            const LockTable& t = *lock_table_;
+            const long moved = t.granted + t.renewed + t.released + t.expired;
+            if (moved == last_reported_) return;
+            last_reported_ = moved;
+            std::cout << "[" << name_ << "] locks: " << t.locks.size() << " keys, " << t.granted << " granted, "
+                      << t.renewed << " renewed, " << t.released << " released, " << t.expired
+                      << " expired (lease " << t.default_lease.count() << " ms)" << std::endl;
+        }
+
+        grpc::ServerCompletionQueue* cq_;
+        grpc::Alarm alarm_;
+        LockTable* lock_table_;
+        std::mutex* mu_;
+        std::string name_;
+        std::chrono::steady_clock::time_point next_report_;
+        long last_reported_ = 0;
+    };
+
+    std::string server_address_;
+    std::unique_ptr<Coordinator> coordinator_;
+    abd::ABDService::AsyncService service_;
+    std::unique_ptr<grpc::ServerCompletionQueue> cq_;
+    std::unique_ptr<grpc::Server> server_;
+
+    std::mutex mu_;
+    std::unordered_map<std::string, Entry> table_;
+
+    // erasure-coded mode, separate keyspace from table_
+    int cas_delta_;
+    std::unordered_map<std::string, CasVersions> cas_table_;
+
+    // NEW: per-key lock owner (client_id) for blocking protocol, as leases
+    LockTable lock_table_;
+
+    // oldest generation of our group still served, see CheckGeneration
+    std::atomic<uint32_t> min_generation_{0};
+};
+
+int main(int argc, char** argv) {
+    // --peers servers.conf: accept CoordinatedPut/Get, run against the group each address
+    // is listed in (same file format, and the same R/W lines, as the clients')
+    // --coordinator-threads T: workers per address for those (default 4)
+    // --cas-delta D: erasure-coded versions kept beyond the newest finalized one (default 2)
+    // --lease-ms L: lock lease when the client doesn't ask for one (default 2000)
+    // --lock-preference fifo|writers|readers: who's next when GETs and PUTs queue (default fifo)
+    std::string peers_path;
+    int coordinator_threads = 4;
+    int cas_delta = 2;
+    int lease_ms = 2000;
+    LockPreference lock_preference = LockPreference::FIFO;
+    std::vector<std::string> addrs;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--peers" && i + 1 < argc) {
+            peers_path = argv[++i];
+        } else if (arg == "--coordinator-threads" && i + 1 < argc) {
+            coordinator_threads = std::atoi(argv[++i]);
+        } else if (arg == "--cas-delta" && i + 1 < argc) {
+            cas_delta = std::atoi(argv[++i]);
+        } else if (arg == "--lease-ms" && i + 1 < argc) {
+            lease_ms = std::atoi(argv[++i]);
+        } else if (arg == "--lock-preference" && i + 1 < argc) {
+            std::string p = argv[++i];
+            if (p == "fifo") {
+                lock_preference = LockPreference::FIFO;
+            } else if (p == "writers") {
+                lock_preference = LockPreference::WRITERS;
+            } else if (p == "readers") {
+                lock_preference = LockPreference::READERS;
+            } else {
+                std::cerr << "Unknown lock preference: " << p << "\n";
+                return 1;
+            }
+        } else {
+            addrs.push_back(arg);
+        }
+    }
+    if (addrs.empty() || coordinator_threads < 1 || cas_delta < 0 || lease_ms < 1) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--peers servers.conf] [--coordinator-threads T] [--cas-delta D] [--lease-ms L]"
+                  << " [--lock-preference fifo|writers|readers]"
+                  << " <server_address> [more addresses...]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::vector<ServerGroup> groups;
+    QuorumConfig quorums;
+    if (!peers_path.empty()) {
+        if (!LoadServerGroups(peers_path, groups, &quorums)) return 1;
+    }
+
+    // One independent replica per address, each with its own table, CQ and thread, so one
+    // process (one EC2 box) can sit in several replica groups from servers.conf
+    std::vector<std::unique_ptr<ABDServer>> servers;
+    std::vector<std::thread> threads;
+    for (const auto& addr : addrs) {
+        std::unique_ptr<Coordinator> coordinator;
+        if (!peers_path.empty()) {
+            auto g = std::find_if(groups.begin(), groups.end(), [&](const ServerGroup& group) {
+                return std::find(group.addrs.begin(), group.addrs.end(), addr) != group.addrs.end();
+            });
+            if (g == groups.end()) {
+                std::cerr << addr << " is not in any group of " << peers_path << "\n";
+                return 1;
+            }
+            QuorumConfig q = quorums;
+            if (!ValidateQuorums(static_cast<int>(g->addrs.size()), q)) return 1;
+            coordinator.reset(new Coordinator(*g, q, addr, coordinator_threads));
+        }
+        servers.emplace_back(new ABDServer(addr, std::move(coordinator), cas_delta, lease_ms, lock_preference));
+    }
+    for (auto& server : servers) {
+        threads.emplace_back([&server] { server->Run(); });
+    }
+    for (auto& t : threads) t.join();
 
     return 0;
 }
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+
+// Retry delays for a lock someone else holds: exponential backoff with decorrelated jitter,
+// each delay uniform in [base, 3 * previous delay] and capped, so clients that collided
+// once don't keep retrying in lockstep.
+//
+// What the replica tells us about the holder steers it. A different holder than at our
+// last try means the lock is changing hands (short critical sections), so it will be free
+// again soon: the ramp is cut in half. Not all the way back to base, a lock that keeps
+// changing hands without coming to us has plenty of other takers. The same holder means
+// it is sitting on it, and the delays keep growing towards the cap.
+class Backoff {
+public:
+    using Micros = std::chrono::microseconds;
+
+    Backoff(Micros base, Micros cap, uint64_t seed) : base_(base), cap_(std::max(base, cap)), rng_(seed) {}
+
+    void SetRange(Micros base, Micros cap)
+    {
+        base_ = base;
+        cap_ = std::max(base, cap);
+        Reset();
+    }
+    Micros Base() const { return base_; }
+    Micros Cap() const { return cap_; }
+
+    // a new lock to wait for: no history
+    void Reset()
+    {
+        prev_ = Micros(0);
+        holder_.clear();
+    }
+
+    // the holder a refusal named; a change of hands counts as churn
+    void Observe(const std::string& holder)
+    {
+        if (holder == holder_) return;
+        holder_ = holder;
+        prev_ /= 2;
+        churn_++;
+    }
+
+    Micros Next()
+    {
+        const int64_t lo = base_.count();
+        const int64_t hi = std::min<int64_t>(cap_.count(), std::max<int64_t>(lo, prev_.count() * 3));
+        prev_ = Micros(std::uniform_int_distribution<int64_t>(lo, hi)(rng_));
+        return prev_;
+    }
+
+    // holder changes seen so far
+    long Churn() const { return churn_; }
+
+private:
+    Micros base_;
+    Micros cap_;
+    Micros prev_{0};
+    std::string holder_;
+    std::mt19937_64 rng_;
+    long churn_ = 0;
+};
+
+// "200:20000" -> base 200 us, cap 20000 us
+inline bool ParseBackoff(const char* s, int& base_us, int& cap_us)
+{
+    int base = 0, cap = 0;
+    if (std::sscanf(s, "%d:%d", &base, &cap) != 2 || base < 1 || cap < base) return false;
+    base_us = base;
+    cap_us = cap;
+    return true;
+}
@@ -1,485 +1,86 @@
-#include "proto/abd.grpc.pb.h"
-#include "proto/abd.pb.h"
-#include <grpcpp/grpcpp.h>
+#include "src/BlockingClient_async.h"
+#include "src/ClientCommon.h"
+#include "src/ParallelReplay.h"
+#include "src/ShardedClient.h"
 
 #include <chrono>
+#include <cstdlib>
 #include <fstream>
-#include <iostream>
-#include <memory>
 #include <sstream>
-#include <string>
-#include <sys/types.h>
-#include <unistd.h>
-#include <vector>
 
-#include <thread>
-
-class BlockingClient {
-public:
-    explicit BlockingClient(const std::vector<std::string>& server_addrs)
-    {
-        for (const auto& addr : server_addrs) {
-            std::shared_ptr<grpc::Channel> ch = grpc::CreateChannel(addr, grpc::InsecureChannelCredentials());
-            std::unique_ptr<abd::ABDService::Stub> stub = abd::ABDService::NewStub(ch);
-            replicas_.push_back({addr, std::move(ch), std::move(stub)});
-            std::cout << "BlockingClient connecting to " << addr << "\n";
-        }
-        N_ = static_cast<int>(replicas_.size());
-        R_ = N_ / 2 + 1;
-        W_ = N_ / 2 + 1;
-        client_id_ = std::to_string(getpid());
-    }
-
-    bool Put(const std::string& key, const std::string& value)
-    {
-        // 0) Acquire locks on a write quorum
-        std::vector<int> locked;
-        if (!AcquireQuorumLocks(key, W_, locked)) {
-            std::cerr << "PUT " << key << " failed: could not acquire " << W_ << " locks\n";
-            return false;
-        }
-
-        // 1) WriteQuery to LOCKED replicas only
-        abd::Tag max_tag;
-        max_tag.set_counter(0);
-        max_tag.set_client_id("");
-        bool have_tag = false;
-        int success_count = 0;
-
-        struct AsyncWriteQueryCall {
-            abd::WriteQueryReply reply;
-            grpc::ClientContext ctx;
-            grpc::Status status;
-            std::unique_ptr<grpc::ClientAsyncResponseReader<abd::WriteQueryReply>> responder;
-            std::string address;
-        };
-
-        grpc::CompletionQueue cq;
-        std::vector<AsyncWriteQueryCall*> calls;
-        calls.reserve(locked.size());
-
-        for (int idx : locked) {
-            auto& r = replicas_[idx];
-            auto* call = new AsyncWriteQueryCall;
-            call->address = r.address;
-
-            abd::WriteQueryRequest req;
-            req.set_key(key);
-
-            call->responder = r.stub->PrepareAsyncWriteQuery(&call->ctx, req, &cq);
-            call->responder->StartCall();
-            call->responder->Finish(&call->reply, &call->status, call);
-            calls.push_back(call);
-        }
-
-        int responses = 0;
-        void* got_tag;
-        bool ok = false;
-
-        while (responses < static_cast<int>(calls.size()) && cq.Next(&got_tag, &ok)) {
-            auto* call = static_cast<AsyncWriteQueryCall*>(got_tag);
-            responses++;
-
-            if (!ok || !call->status.ok()) {
-                std::cerr << "WriteQuery to " << call->address
-                          << " failed for PUT " << key << ": "
-                          << (call->status.ok() ? "stream not ok" : call->status.error_message())
-                          << "\n";
-            } else {
-                success_count++;
-                const abd::Tag& t = call->reply.tag();
-                if (!have_tag || TagGreater(t, max_tag)) {
-                    max_tag = t;
-                    have_tag = true;
-                }
-            }
-
-            delete call;
-        }
-
-        if (success_count < W_) {
-            std::cerr << "PUT " << key
-                      << " failed: did not reach write quorum in WriteQuery phase ("
-                      << success_count << " < " << W_ << ")\n";
-            ReleaseLocks(key, locked);
-            return false;
-        }
-
-        // 2) Choose new tag
-        abd::Tag new_tag;
-        new_tag.set_counter(max_tag.counter() + 1);
-        new_tag.set_client_id(client_id_);
-
-        // 3) WriteProp ONLY to locked replicas
-        struct AsyncWritePropCall {
-            abd::Ack reply;
-            grpc::ClientContext ctx;
-            grpc::Status status;
-            std::unique_ptr<grpc::ClientAsyncResponseReader<abd::Ack>> responder;
-            std::string address;
-        };
-
-        grpc::CompletionQueue cq2;
-        std::vector<AsyncWritePropCall*> calls2;
-        calls2.reserve(locked.size());
-
-        for (int idx : locked) {
-            auto& r = replicas_[idx];
-            auto* call = new AsyncWritePropCall;
-            call->address = r.address;
-
-            abd::WritePropRequest req;
-            req.set_key(key);
-            *req.mutable_tag() = new_tag;
-            req.set_value(value);
-
-            call->responder = r.stub->PrepareAsyncWriteProp(&call->ctx, req, &cq2);
-            call->responder->StartCall();
-            call->responder->Finish(&call->reply, &call->status, call);
-            calls2.push_back(call);
-        }
-
-        int ack_count = 0;
-        responses = 0;
-
-        while (responses < static_cast<int>(calls2.size()) && cq2.Next(&got_tag, &ok)) {
-            auto* call = static_cast<AsyncWritePropCall*>(got_tag);
-            responses++;
-
-            if (!ok || !call->status.ok() || !call->reply.ok()) {
-                std::cerr << "WriteProp to " << call->address
-                          << " failed for PUT " << key << ": "
-                          << (call->status.ok() ? "NOK Ack or stream not ok"
-                                                : call->status.error_message())
-                          << "\n";
-            } else {
-                ack_count++;
-            }
-
-            delete call;
-        }
-
-        // 4) Release locks before returning
-        ReleaseLocks(key, locked);
-
-        if (ack_count < W_) {
-            std::cerr << "PUT " << key
-                      << " failed: did not reach write quorum in WriteProp phase ("
-                      << ack_count << " < " << W_ << ")\n";
-            return false;
-        }
-
-        std::cout << " PUT " << key << " = " << value
-                  << " (tag.counter=" << new_tag.counter()
-                  << ", tag.client_id=" << new_tag.client_id() << ")\n";
-        return true;
-    }
-
-    bool Get(const std::string& key, std::string& value_out)
-    {
-        // 0) Acquire locks on a read quorum
-        std::vector<int> locked;
-        if (!AcquireQuorumLocks(key, R_, locked)) {
-            std::cerr << "GET " << key << " failed: could not acquire " << R_ << " locks\n";
-            return false;
-        }
-
-        // 1) ReadQuery to locked replicas
-        abd::Tag max_tag;
-        max_tag.set_counter(0);
-        max_tag.set_client_id("");
-        std::string max_value;
-        bool have_value = false;
-        int success_count = 0;
-
-        struct AsyncReadQueryCall {
-            abd::ReadQueryReply reply;
-            grpc::ClientContext ctx;
-            grpc::Status status;
-            std::unique_ptr<grpc::ClientAsyncResponseReader<abd::ReadQueryReply>> responder;
-            std::string address;
-        };
-
-        grpc::CompletionQueue cq;
-        std::vector<AsyncReadQueryCall*> calls;
-        calls.reserve(locked.size());
-
-        for (int idx : locked) {
-            auto& r = replicas_[idx];
-            auto* call = new AsyncReadQueryCall;
-            call->address = r.address;
-
-            abd::ReadQueryRequest req;
-            req.set_key(key);
-
-            call->responder = r.stub->PrepareAsyncReadQuery(&call->ctx, req, &cq);
-            call->responder->StartCall();
-            call->responder->Finish(&call->reply, &call->status, call);
-            calls.push_back(call);
-        }
-
-        void* got_tag;
-        bool ok = false;
-        int responses = 0;
-
-        while (responses < static_cast<int>(calls.size()) && cq.Next(&got_tag, &ok)) {
-            auto* call = static_cast<AsyncReadQueryCall*>(got_tag);
-            responses++;
-
-            if (!ok || !call->status.ok()) {
-                std::cerr << "ReadQuery to " << call->address
-                          << " failed for GET " << key << ": "
-                          << (call->status.ok() ? "stream not ok" : call->status.error_message())
-                          << "\n";
-            } else {
-                success_count++;
-                const abd::Tag& t = call->reply.tag();
-                if (!have_value || TagGreater(t, max_tag)) {
-                    max_tag = t;
-                    max_value = call->reply.value();
-                    have_value = true;
-                }
-            }
-
-            delete call;
-        }
-
-        if (success_count < R_ || !have_value) {
-            std::cerr << "GET " << key
-                      << " failed: did not reach read quorum in ReadQuery phase ("
-                      << success_count << " < " << R_ << ")\n";
-            ReleaseLocks(key, locked);
-            return false;
-        }
-
-        // 2) Write-back via WriteProp to locked replicas (ABD-style)
-        struct AsyncWritePropCall {
-            abd::Ack reply;
-            grpc::ClientContext ctx;
-            grpc::Status status;
-            std::unique_ptr<grpc::ClientAsyncResponseReader<abd::Ack>> responder;
-            std::string address;
-        };
-
-        grpc::CompletionQueue cq2;
-        std::vector<AsyncWritePropCall*> calls2;
-        calls2.reserve(locked.size());
-
-        for (int idx : locked) {
-            auto& r = replicas_[idx];
-            auto* call = new AsyncWritePropCall;
-            call->address = r.address;
-
-            abd::WritePropRequest req;
-            req.set_key(key);
-            *req.mutable_tag() = max_tag;
-            req.set_value(max_value);
-
-            call->responder = r.stub->PrepareAsyncWriteProp(&call->ctx, req, &cq2);
-            call->responder->StartCall();
-            call->responder->Finish(&call->reply, &call->status, call);
-            calls2.push_back(call);
-        }
-
-        int ack_count = 0;
-        responses = 0;
-
-        while (responses < static_cast<int>(calls2.size()) && cq2.Next(&got_tag, &ok)) {
-            auto* call = static_cast<AsyncWritePropCall*>(got_tag);
-            responses++;
-
-            if (!ok || !call->status.ok() || !call->reply.ok()) {
-                std::cerr << "WriteProp (read write-back) to " << call->address
-                          << " failed for GET " << key << ": "
-                          << (call->status.ok() ? "NOK Ack or stream not ok"
-                                                : call->status.error_message())
-                          << "\n";
-            } else {
-                ack_count++;
-            }
-
-            delete call;
-        }
-
-        // 3) Release locks before returning
-        ReleaseLocks(key, locked);
-
-        if (ack_count < R_) {
-            std::cerr << "GET " << key
-                      << " failed: did not reach read quorum in WriteProp phase ("
-                      << ack_count << " < " << R_ << ")\n";
-            return false;
-        }
-
-        value_out = max_value;
-        std::cout << " GET " << key << " -> " << value_out
-                  << " (tag.counter=" << max_tag.counter()
-                  << ", tag.client_id=" << max_tag.client_id() << ")\n";
-        return true;
-    }
-
-private:
-    struct Replica {
-        std::string address;
-        std::shared_ptr<grpc::Channel> channel;
-        std::unique_ptr<abd::ABDService::Stub> stub;
-    };
-
-    static bool TagGreater(const abd::Tag& a, const abd::Tag& b)
-    {
-        if (a.counter() != b.counter()) return a.counter() > b.counter();
-        return a.client_id() > b.client_id();
-    }
-
-    // Acquire locks on a quorum q; block/retry if not enough are granted
-    bool AcquireQuorumLocks(const std::string& key, int q, std::vector<int>& locked_indices)
-    {
-        locked_indices.clear();
-        // We just spin until we get q locks (can be blocked by other clients)
-        while (static_cast<int>(locked_indices.size()) < q) {
-            struct AsyncAcquireLockCall {
-                abd::AcquireLockReply reply;
-                grpc::ClientContext ctx;
-                grpc::Status status;
-                std::unique_ptr<grpc::ClientAsyncResponseReader<abd::AcquireLockReply>> responder;
-                std::string address;
-                int replica_index;
-            };
-
-            grpc::CompletionQueue cq;
-            std::vector<AsyncAcquireLockCall*> calls;
-            calls.reserve(replicas_.size());
-
-            // Send AcquireLock to all replicas where we *do not yet* hold the lock
-            for (int i = 0; i < N_; ++i) {
-                if (std::find(locked_indices.begin(), locked_indices.end(), i) != locked_indices.end()) {
-                    continue; // already locked
-                }
-
-                auto& r = replicas_[i];
-                auto* call = new AsyncAcquireLockCall;
-                call->address = r.address;
-                call->replica_index = i;
-
-                abd::AcquireLockRequest req;
-                req.set_key(key);
-                req.set_client_id(client_id_);
-
-                call->responder = r.stub->PrepareAsyncAcquireLock(&call->ctx, req, &cq);
-                call->responder->StartCall();
-                call->responder->Finish(&call->reply, &call->status, call);
-                calls.push_back(call);
-            }
-
-            void* got_tag;
-            bool ok = false;
-            int responses = 0;
-
-            while (responses < static_cast<int>(calls.size()) && cq.Next(&got_tag, &ok)) {
-                auto* call = static_cast<AsyncAcquireLockCall*>(got_tag);
-                responses++;
-
-                if (!ok || !call->status.ok()) {
-                    std::cerr << "AcquireLock to " << call->address
-                              << " failed for key " << key << ": "
-                              << (call->status.ok() ? "stream not ok" : call->status.error_message())
-                              << "\n";
-                } else {
-                    if (call->reply.granted()) {
-                        // Got the lock on this replica
-                        if (std::find(locked_indices.begin(), locked_indices.end(), call->replica_index) == locked_indices.end()) {
-                            locked_indices.push_back(call->replica_index);
-                        }
-                    } else {
-                        // Lock held by someone else → this is where blocking semantics come from
-                        // We don't add it; we will retry in the next outer loop iteration.
-                    }
-                }
-
-                delete call;
-            }
-
-            if (static_cast<int>(locked_indices.size()) >= q) {
-                return true;
+int main(int argc, char** argv) {
+    // --max-in-flight N > 1 replays ops on different keys concurrently (per-key order kept)
+    int max_in_flight = 1;
+    QuorumConfig quorum_flags; // --read-quorum R / --write-quorum W, override servers.conf
+    Consistency default_level = Consistency::LINEARIZABLE; // --consistency, for GETs without one
+    int lock_wait_ms = 0; // --lock-wait ms: queue on held locks server-side instead of polling
+    int lease_ms = 0;     // --lease-ms ms: lock lease to ask for, 0 -> the server's
+    int backoff_base_us = 200, backoff_cap_us = 20000; // --lock-backoff base:cap, lock poll delays
+    int session_idle_ms = 0; // --lock-session idle_ms: keep locks between ops on the same key
+    bool coordinator = false; // --lock-coordinator: each key's lock on one replica, fenced writes
+    bool fused = false;   // --fused-locks: AcquireAndQuery / PropAndRelease, two round trips per op
+    bool shared_reads = true; // --exclusive-reads: GETs lock like PUTs (the old behaviour)
+    bool skip_write_back = true; // --always-write-back: GETs write back even when the tag is settled
+    std::string input_path;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--max-in-flight" && i + 1 < argc) {
+            max_in_flight = std::atoi(argv[++i]);
+        } else if (arg == "--consistency" && i + 1 < argc) {
+            if (!ParseConsistency(argv[++i], default_level)) {
+                std::cerr << "Unknown consistency level: " << argv[i] << "\n";
+                return 1;
             }
-
-            // Optional: small sleep to avoid busy spinning
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
-        }
-
-        return true;
-    }
-
-    void ReleaseLocks(const std::string& key, const std::vector<int>& locked_indices)
-    {
-        for (int idx : locked_indices) {
-            auto& r = replicas_[idx];
-            abd::ReleaseLockRequest req;
-            req.set_key(key);
-            req.set_client_id(client_id_);
-            abd::ReleaseLockReply rep;
-            grpc::ClientContext ctx;
-            grpc::Status status = r.stub->ReleaseLock(&ctx, req, &rep);
-            if (!status.ok() || !rep.ok()) {
-                std::cerr << "ReleaseLock to " << r.address
-                          << " failed for key " << key << ": "
-                          << (status.ok() ? "Reply not ok" : status.error_message())
-                          << "\n";
+        } else if (arg == "--read-quorum" && i + 1 < argc) {
+            quorum_flags.R = std::atoi(argv[++i]);
+        } else if (arg == "--write-quorum" && i + 1 < argc) {
+            quorum_flags.W = std::atoi(argv[++i]);
+        } else if (arg == "--lock-wait" && i + 1 < argc) {
+            lock_wait_ms = std::atoi(argv[++i]);
+        } else if (arg == "--lease-ms" && i + 1 < argc) {
+            lease_ms = std::atoi(argv[++i]);
+        } else if (arg == "--lock-backoff" && i + 1 < argc) {
+            if (!ParseBackoff(argv[++i], backoff_base_us, backoff_cap_us)) {
+                std::cerr << "Bad --lock-backoff, want base_us:cap_us: " << argv[i] << "\n";
+                return 1;
             }
+        } else if (arg == "--lock-session" && i + 1 < argc) {
+            session_idle_ms = std::atoi(argv[++i]);
+        } else if (arg == "--lock-coordinator") {
+            coordinator = true;
+        } else if (arg == "--fused-locks") {
+            fused = true;
+        } else if (arg == "--exclusive-reads") {
+            shared_reads = false;
+        } else if (arg == "--always-write-back") {
+            skip_write_back = false;
+        } else {
+            input_path = arg;
         }
     }
-
-    std::vector<Replica> replicas_;
-    int N_ = 0;
-    int R_ = 0;
-    int W_ = 0;
-    std::string client_id_;
-};
-
-static std::string Trim(const std::string& s)
-{
-    std::string result = s;
-    auto start = result.find_first_not_of(" \t\r\n");
-    if (start == std::string::npos) return "";
-    auto end = result.find_last_not_of(" \t\r\n");
-    return result.substr(start, end - start + 1);
-}
-
-int main(int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " <input_file>" << std::endl;
+    if (input_path.empty() || max_in_flight < 1 || lock_wait_ms < 0 || lease_ms < 0 || session_idle_ms < 0 ||
+        (session_idle_ms > 0 && fused) || (coordinator && fused)) {
+        std::cerr << "Usage: " << argv[0] << " [--max-in-flight N] [--read-quorum R] [--write-quorum W] [--lock-wait ms] [--lock-backoff base_us:cap_us] [--lease-ms ms] [--lock-session idle_ms] [--lock-coordinator] [--fused-locks] [--exclusive-reads] [--always-write-back] [--consistency linearizable|regular|one] <input_file>" << std::endl;
         return 1;
     }
 
-    const std::string input_path = argv[1];
     std::ifstream in(input_path);
     if (!in.is_open()) {
         std::cerr << "Failed to open input file: " << input_path << "\n";
         return 1;
     }
 
-    std::ifstream cfg("servers.conf");
-    if (!cfg.is_open()) {
-        std::cerr << "Failed to open servers.conf\n";
+    std::vector<ServerGroup> groups;
+    QuorumConfig quorums;
+    if (!LoadServerGroups("servers.conf", groups, &quorums)) {
         return 1;
     }
-
-    std::vector<std::string> server_addrs;
-    std::string line_cfg;
-    while (std::getline(cfg, line_cfg)) {
-        std::string trimmed = Trim(line_cfg);
-        if (trimmed.empty()) continue;
-        if (trimmed[0] == '#') continue;
-        server_addrs.push_back(trimmed);
-    }
-
-    if (server_addrs.empty()) {
-        std::cerr << "No server addresses found in servers.conf\n";
+    if (quorum_flags.R) quorums.R = quorum_flags.R;
+    if (quorum_flags.W) quorums.W = quorum_flags.W;
+    if (!ValidateGroupQuorums(groups, quorums)) {
         return 1;
     }
 
-    BlockingClient client(server_addrs);
-
     auto now = std::chrono::system_clock::now();
     std::time_t t = std::chrono::system_clock::to_time_t(now);
     std::tm tm = *std::localtime(&t);
@@ -493,59 +94,139 @@ int main(int argc, char** argv) {
         std::cerr << "Failed to open CSV file: " << csv_path << "\n";
         return 1;
     }
-    csv << "op,key,value,latency_ms,success\n";
-
-    std::string line;
+    csv << "op,key,value,latency_ms,success,consistency\n";
 
     auto tt_start = std::chrono::steady_clock::now();
     int ops = 0;
 
-    while (std::getline(in, line)) {
-        std::string trimmed = Trim(line);
-        if (trimmed.empty()) continue;
-        if (trimmed[0] == '#') continue;
-
-        std::istringstream iss(trimmed);
-        std::string cmd;
-        iss >> cmd;
-        if (cmd == "PUT" || cmd == "put") {
-            std::string key;
-            iss >> key;
-            std::string value;
-            std::getline(iss, value);
-            value = Trim(value);
-
-            //time measuring. overhead should be negligible/irrelevant, we are looking at differences most of all. Plug into R for cool plots
-            auto op_start = std::chrono::steady_clock::now();
-            bool ok = client.Put(key, value);
-            auto op_end = std::chrono::steady_clock::now();
-            auto latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(op_end - op_start).count();
-
-
-            csv << "PUT," << key << "," << value << "," << latency_ms << "," << (ok ? 1 : 0) << "\n";
+    if (max_in_flight > 1) {
+        std::vector<WorkloadOp> workload;
+        if (!LoadWorkload(input_path, workload, default_level)) {
+            return 1;
+        }
+
+        // one client object per in-flight slot over shared channels, each with its own
+        // client_id (pid-i, as load_driver names its clients)
+        auto channels = CreateGroupChannels(groups);
+        std::string pid = std::to_string(getpid());
+        std::vector<std::unique_ptr<ShardedClient<BlockingClient>>> clients;
+        for (int i = 0; i < max_in_flight; ++i) {
+            clients.emplace_back(new ShardedClient<BlockingClient>(groups, channels, pid + "-" + std::to_string(i)));
+            clients.back()->SetQuorums(groups, quorums);
+            clients.back()->SetLockWait(lock_wait_ms);
+            clients.back()->SetLease(lease_ms);
+            clients.back()->SetFused(fused);
+            clients.back()->SetSharedReads(shared_reads);
+            clients.back()->SetLockBackoff(backoff_base_us, backoff_cap_us);
+            clients.back()->SetLockSessions(session_idle_ms);
+            clients.back()->SetLockCoordinator(coordinator);
+            clients.back()->SetSkipSettledWriteBack(skip_write_back);
+        }
+
+        tt_start = std::chrono::steady_clock::now();
+        std::vector<ReplayResult> results = ReplayByKey(workload, clients);
+
+        // rows in file order, not completion order, so runs stay diffable
+        for (size_t i = 0; i < workload.size(); ++i) {
+            const WorkloadOp& op = workload[i];
+            const ReplayResult& res = results[i];
+            const char* cmd = (op.type == WorkloadOp::PUT) ? "PUT" : "GET";
+            const std::string& value = (op.type == WorkloadOp::PUT) ? op.value : res.value;
+            const Consistency level = (op.type == WorkloadOp::PUT) ? Consistency::LINEARIZABLE : op.consistency;
+            csv << cmd << "," << op.key << "," << value << "," << res.latency_ms << "," << (res.ok ? 1 : 0)
+                << "," << ConsistencyName(level) << "\n";
             ops++;
-
-            if (!ok) {
-                std::cerr << "PUT failed for key " << key << "\n";
+            if (!res.ok) {
+                std::cerr << cmd << " failed for key " << op.key << "\n";
             }
-        } else if (cmd == "GET" || cmd == "get") {
-            std::string key;
-            iss >> key;
-            std::string value;
+        }
+    } else {
+        ShardedClient<BlockingClient> client(groups);
+        client.SetQuorums(groups, quorums);
+        client.SetLockWait(lock_wait_ms);
+        client.SetLease(lease_ms);
+        client.SetFused(fused);
+        client.SetSharedReads(shared_reads);
+        client.SetLockBackoff(backoff_base_us, backoff_cap_us);
+        client.SetLockSessions(session_idle_ms);
+        client.SetLockCoordinator(coordinator);
+        client.SetSkipSettledWriteBack(skip_write_back);
+        std::string line;
+
+        while (std::getline(in, line)) {
+            std::string trimmed = Trim(line);
+            if (trimmed.empty()) continue;
+            if (trimmed[0] == '#') continue;
+
+            std::istringstream iss(trimmed);
+            std::string cmd;
+            iss >> cmd;
+            if (cmd == "PUT" || cmd == "put") {
+                std::string key;
+                iss >> key;
+                std::string value;
+                std::getline(iss, value);
+                value = Trim(value);
+
+                //time measuring. overhead should be negligible/irrelevant, we are looking at differences most of all. Plug into R for cool plots
+                auto op_start = std::chrono::steady_clock::now();
+                bool ok = client.Put(key, value);
+                auto op_end = std::chrono::steady_clock::now();
+                auto latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(op_end - op_start).count();
+
+
+                csv << "PUT," << key << "," << value << "," << latency_ms << "," << (ok ? 1 : 0)
+                    << "," << ConsistencyName(Consistency::LINEARIZABLE) << "\n";
+                ops++;
+
+                if (!ok) {
+                    std::cerr << "PUT failed for key " << key << "\n";
+                }
+            } else if (cmd == "GET" || cmd == "get") {
+                std::string key;
+                iss >> key;
+                std::string value;
+                std::string level_token;
+                Consistency level = default_level;
+                if (iss >> level_token && !ParseConsistency(level_token, level)) {
+                    std::cerr << "Unknown consistency level in input file: " << level_token << "\n";
+                    continue;
+                }
 
-            auto op_start = std::chrono::steady_clock::now();
-            bool ok = client.Get(key, value);
-            auto op_end = std::chrono::steady_clock::now();
-            auto latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(op_end - op_start).count();
+                auto op_start = std::chrono::steady_clock::now();
+                bool ok = client.Get(key, value, level);
+                auto op_end = std::chrono::steady_clock::now();
+                auto latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(op_end - op_start).count();
 
 
-            csv << "GET," << key << "," << value << "," << latency_ms << "," << (ok ? 1 : 0) << "\n";
-            ops++;
-            if (!ok) {
-                std::cerr << "GET failed for key " << key << "\n";
+                csv << "GET," << key << "," << value << "," << latency_ms << "," << (ok ? 1 : 0)
+                    << "," << ConsistencyName(level) << "\n";
+                ops++;
+                if (!ok) {
+                    std::cerr << "GET failed for key " << key << "\n";
+                }
+            } else if (cmd == "MPUT" || cmd == "mput") {
+                // MPUT k1 v1 k2 v2 ...: one atomic multi-key PUT, values are single words
+                std::vector<std::pair<std::string, std::string>> writes;
+                std::string key, value;
+                while (iss >> key >> value) writes.emplace_back(key, value);
+
+                auto op_start = std::chrono::steady_clock::now();
+                bool ok = !writes.empty() && client.MultiPut(writes);
+                auto op_end = std::chrono::steady_clock::now();
+                auto latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(op_end - op_start).count();
+
+                for (const auto& w : writes) {
+                    csv << "MPUT," << w.first << "," << w.second << "," << latency_ms << "," << (ok ? 1 : 0)
+                        << "," << ConsistencyName(Consistency::LINEARIZABLE) << "\n";
+                }
+                ops++;
+                if (!ok) {
+                    std::cerr << "MPUT failed for " << writes.size() << " keys\n";
+                }
+            } else {
+                std::cerr << "Unknown command in input file: " << cmd << "\n";
             }
-        } else {
-            std::cerr << "Unknown command in input file: " << cmd << "\n";
         }
     }
     auto tt_stop = std::chrono::steady_clock::now();
@@ -558,6 +239,8 @@ int main(int argc, char** argv) {
 
     std::cout << "=== Performance Summary ===\n";
     std::cout << "Total Operations : " << ops << "\n";
+    std::cout << "Max In Flight    : " << max_in_flight << "\n";
+    std::cout << "Quorums          : " << DescribeGroupQuorums(groups, quorums) << "\n";
     std::cout << "Total Time       : " << total_time << " ms (" 
             << total_time_sec << " s)\n";
     std::cout << "Throughput       : " << throughput << " ops/sec\n";
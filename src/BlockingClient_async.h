@@ -0,0 +1,1178 @@
+#pragma once
+
+#include "proto/abd.grpc.pb.h"
+#include "proto/abd.pb.h"
+#include "src/Backoff.h"
+#include "src/Consistency.h"
+#include "src/HashRing.h"
+#include "src/NearCache.h"
+#include "src/QuorumCall.h"
+#include <grpcpp/grpcpp.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <sys/types.h>
+#include <unistd.h>
+#include <vector>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <random>
+#include <thread>
+
+class BlockingClient {
+public:
+    explicit BlockingClient(const std::vector<std::string>& server_addrs)
+    {
+        for (const auto& addr : server_addrs) {
+            std::shared_ptr<grpc::Channel> ch = grpc::CreateChannel(addr, grpc::InsecureChannelCredentials());
+            std::unique_ptr<abd::ABDService::Stub> stub = abd::ABDService::NewStub(ch);
+            std::unique_ptr<grpc::GenericStub> generic_stub(new grpc::GenericStub(ch));
+            replicas_.push_back({addr, std::move(ch), std::move(stub), std::move(generic_stub)});
+            std::cout << "BlockingClient connecting to " << addr << "\n";
+        }
+        InitQuorums();
+        client_id_ = std::to_string(getpid());
+    }
+
+    // Logical client over channels owned by someone else (load driver): many of these
+    // share one connection per replica, so each needs its own client_id for tags/locks.
+    BlockingClient(const std::vector<std::string>& server_addrs,
+                   const std::vector<std::shared_ptr<grpc::Channel>>& channels,
+                   const std::string& client_id)
+    {
+        for (size_t i = 0; i < server_addrs.size(); ++i) {
+            replicas_.push_back({server_addrs[i], channels[i], abd::ABDService::NewStub(channels[i]),
+                                 std::unique_ptr<grpc::GenericStub>(new grpc::GenericStub(channels[i]))});
+        }
+        InitQuorums();
+        client_id_ = client_id;
+    }
+
+    // per-op stdout lines; the load driver turns these off
+    void SetVerbose(bool verbose) { verbose_ = verbose; }
+
+    // PUTs lock W replicas, GETs lock R (linearizable ones max(R, W), see ReadLockQuorum).
+    // R + W > N keeps reads and writes exclusive and W > N/2 keeps writes exclusive of
+    // each other, see ValidateQuorums.
+    void SetQuorums(int R, int W)
+    {
+        R_ = R;
+        W_ = W;
+    }
+
+    // >0: a held lock queues us server-side for up to this long instead of us polling
+    // (see AcquireQuorumLocks)
+    void SetLockWait(int ms) { lock_wait_ms_ = ms; }
+
+    // Delays between polls of a held lock, see Backoff.h. Low base for locks that turn
+    // over fast, cap for ones that are held long.
+    void SetLockBackoff(int base_us, int cap_us)
+    {
+        backoff_.SetRange(std::chrono::microseconds(base_us), std::chrono::microseconds(cap_us));
+    }
+
+    // acquires, and AcquireLocks that came back "held" and had to be sent again
+    long LockAcquires() const { return lock_acquires_; }
+    long LockRetries() const { return lock_retries_; }
+    long LockHolderChanges() const { return backoff_.Churn(); }
+
+    // AcquireLock RPCs sent so far, to compare polling against queueing
+    long LockRpcs() const { return lock_rpcs_; }
+
+    // acquires the first all-at-once round didn't settle, finished in replica order
+    long OrderedAcquires() const { return ordered_acquires_; }
+
+    // Locks are leases on the server. 0 takes the server's --lease-ms; either way we renew
+    // between phases once half of it is gone, so only a stalled client loses one.
+    void SetLease(int ms) { lease_ms_ = ms; }
+
+    // renewals sent, and releases a replica refused because our lease had run out (and
+    // maybe someone else got the lock in the meantime)
+    long LeaseRenewals() const { return lease_renewals_; }
+    long LeasesLost() const { return leases_lost_; }
+
+    // Fused lock RPCs: AcquireAndQuery takes the lock and does the query phase in one
+    // round trip, PropAndRelease does the last phase and unlocks. A PUT (or linearizable
+    // GET) is then two round trips instead of three plus the release.
+    void SetFused(bool fused) { fused_ = fused; }
+
+    // GETs take the lock SHARED by default, so reads of a hot key don't queue behind each
+    // other, only behind PUTs (R + W > N still puts a replica between every GET and PUT).
+    // Their write-back is a tagged ABD write like any other, safe to run side by side.
+    void SetSharedReads(bool shared) { shared_reads_ = shared; }
+
+    // Locked GETs return right after the query phase when the newest tag they found is
+    // settled, i.e. its PUT reported a full write quorum (see Get). On by default; off
+    // always writes back, as before. Fused GETs always go through PropAndRelease, which
+    // they need for the unlock anyway.
+    void SetSkipSettledWriteBack(bool skip) { skip_settled_write_back_ = skip; }
+
+    // linearizable GETs that returned without a write-back
+    long WriteBacksSkipped() const { return write_backs_skipped_; }
+
+    // Lock sessions (idle_ms > 0): an op keeps its locks when it's done, and the next op on
+    // the same key (in a mode they cover) goes straight to its data phases. The locks go
+    // when we move on to another key, when a query phase reports that someone else wants
+    // them (lock_wanted), or when nothing renews them for idle_ms: session locks are
+    // leased for that long, so an idle client holds others up for idle_ms at most. Not
+    // with fused lock RPCs, PropAndRelease always unlocks.
+    void SetLockSessions(int idle_ms) { session_idle_ms_ = idle_ms; }
+
+    // ops that ran on a session's locks without acquiring
+    long SessionOps() const { return session_ops_; }
+
+    // Lock coordinator mode: a key's lock lives on one replica of the group, picked by
+    // hashing the key over the servers.conf addresses (HashRing), instead of on a quorum.
+    // An op then costs one AcquireLock and one ReleaseLock, not one of each per replica,
+    // and contention has no replica order to sort out. The data phases go to every replica
+    // and wait for R/W, plain ABD. A writer whose lease ran out could still land after the
+    // next holder; the epoch every grant comes with stops that. Our WriteProps carry it,
+    // and a replica refuses one older than an epoch it has seen for the key. The price is
+    // availability: while a key's coordinator is down nobody can lock that key, where
+    // quorum locks ride out N - W failures. Every client of a group has to use the same
+    // mode. Not with fused lock RPCs (their query phase is the locked quorum) or MultiPut.
+    void SetLockCoordinator(bool coordinator) { coordinator_locks_ = coordinator; }
+
+    // WriteProps a replica refused as fenced (an epoch older than it has seen)
+    long FencedWrites() const { return fenced_writes_; }
+
+    // hands back the session's locks, if any
+    void EndSession()
+    {
+        if (!in_session_) return;
+        in_session_ = false;
+        ReleaseLocks(session_key_, locked_, have_session_settled_ ? &session_settled_ : nullptr);
+        have_session_settled_ = false;
+    }
+
+    ~BlockingClient() { EndSession(); }
+
+    bool Put(const std::string& key, const std::string& value)
+    {
+        if (fused_) return FusedPut(key, value);
+
+        // 0) Acquire locks on a write quorum (or keep the session's)
+        std::vector<int>& locked = locked_;
+        if (!LockForOp(key, W_, abd::EXCLUSIVE, locked)) {
+            std::cerr << "PUT " << key << " failed: could not acquire " << W_ << " locks\n";
+            return false;
+        }
+
+        // 1) WriteQuery to LOCKED replicas only (every replica if the lock is elsewhere)
+        const std::vector<int>& targets = DataReplicas(locked);
+        abd::Tag max_tag;
+        bool wanted = false;
+        if (!WriteQueryRound(key, targets, max_tag, wanted)) {
+            FinishLocked(key, locked, false, nullptr);
+            return false;
+        }
+
+        RenewLeasesIfDue(key, locked);
+
+        // 2) Choose new tag
+        abd::WritePropRequest& req = write_prop_->request();
+        req.set_key(key);
+        req.mutable_tag()->set_counter(max_tag.counter() + 1);
+        req.mutable_tag()->set_client_id(client_id_);
+        req.set_value(value);
+
+        // 3) WriteProp ONLY to the replicas we queried
+        int ack_count = WritePropRound(key, targets, W_, false);
+
+        // 4) Release locks before returning (or keep them for the session); with a full
+        // quorum of acks the replicas mark the tag settled, which lets GETs that find it
+        // skip their write-back
+        FinishLocked(key, locked, ack_count >= W_ && !wanted, ack_count >= W_ ? &req.tag() : nullptr);
+
+        if (ack_count < W_) {
+            std::cerr << "PUT " << key
+                      << " failed: did not reach write quorum in WriteProp phase ("
+                      << ack_count << " < " << W_ << ")\n";
+            return false;
+        }
+
+        near_cache_.Update(key, req.tag(), value);
+        if (verbose_) std::cout << " PUT " << key << " = " << value
+                  << " (tag.counter=" << req.tag().counter()
+                  << ", tag.client_id=" << req.tag().client_id() << ")\n";
+        return true;
+    }
+
+    // Multi-key PUT, all or nothing as far as other locked ops can tell. The locks of every
+    // key are taken together, one AcquireLocks per replica whatever the number of keys, on
+    // a write quorum (replica order under contention, as AcquireQuorumLocks). Then each key
+    // goes through its WriteQuery and WriteProp under them, and one ReleaseLocks per
+    // replica lets go of all of it. A GET's read quorum overlaps our write quorum, so it
+    // sees all of these keys from before the transaction or all from after. Not atomic
+    // against us failing halfway: keys written by then stay written.
+    //
+    // Keys are taken in sorted order, once each (the last value given for a key wins).
+    // Not with fused lock RPCs or sessions; a running session is ended first.
+    bool MultiPut(const std::vector<std::pair<std::string, std::string>>& writes)
+    {
+        if (coordinator_locks_) {
+            std::cerr << "MPUT needs quorum locks, not a lock coordinator per key\n";
+            return false;
+        }
+        EndSession();
+        std::map<std::string, std::string> batch;
+        for (const auto& w : writes) batch[w.first] = w.second;
+        if (batch.empty()) return true;
+        std::string label = "{";
+        for (const auto& kv : batch) label += (label.size() > 1 ? "," : "") + kv.first;
+        label += "}";
+
+        // 0) Every key's lock on a write quorum, in one round if uncontended
+        std::vector<int>& locked = locked_;
+        abd::AcquireLocksRequest& acquire = acquire_locks_->request();
+        acquire.clear_keys();
+        for (const auto& kv : batch) acquire.add_keys(kv.first);
+        if (!AcquireQuorumLocks(*acquire_locks_, *acquire.mutable_lock(), label, W_, abd::EXCLUSIVE, locked)) {
+            std::cerr << "MPUT " << label << " failed: could not acquire " << W_ << " locks\n";
+            return false;
+        }
+        multi_puts_++;
+        multi_put_keys_ += static_cast<long>(batch.size());
+
+        // 1-3) Each key's PUT phases under the batch's locks; the tags that made a write
+        // quorum go out as settled with the release, in key order
+        std::vector<abd::Tag> settled;
+        bool ok = true;
+        for (const auto& kv : batch) {
+            abd::Tag max_tag;
+            bool wanted = false;
+            if (!WriteQueryRound(kv.first, locked, max_tag, wanted)) {
+                ok = false;
+                break;
+            }
+            RenewBatchLeasesIfDue(label, locked);
+
+            abd::WritePropRequest& req = write_prop_->request();
+            req.set_key(kv.first);
+            req.mutable_tag()->set_counter(max_tag.counter() + 1);
+            req.mutable_tag()->set_client_id(client_id_);
+            req.set_value(kv.second);
+            int ack_count = WritePropRound(kv.first, locked, W_, false);
+            if (ack_count < W_) {
+                std::cerr << "MPUT " << label << " failed at " << kv.first
+                          << ": did not reach write quorum in WriteProp phase ("
+                          << ack_count << " < " << W_ << ")\n";
+                ok = false;
+                break;
+            }
+            settled.push_back(req.tag());
+            near_cache_.Update(kv.first, req.tag(), kv.second);
+        }
+
+        // 4) All of the locks at once
+        ReleaseBatch(label, locked, settled);
+        if (!ok) return false;
+
+        if (verbose_) {
+            std::cout << " MPUT";
+            for (const auto& kv : batch) std::cout << " " << kv.first << " = " << kv.second;
+            std::cout << " (" << batch.size() << " keys)\n";
+        }
+        return true;
+    }
+
+    // multi-key PUTs that got their locks, and keys written by them
+    long MultiPuts() const { return multi_puts_; }
+    long MultiPutKeys() const { return multi_put_keys_; }
+
+    bool Get(const std::string& key, std::string& value_out,
+             Consistency level = Consistency::LINEARIZABLE)
+    {
+        // ONE doesn't lock at all, it just takes the first replica to answer
+        const bool lock = level != Consistency::ONE;
+        if (lock && fused_) return FusedGet(key, value_out, level);
+        const int quorum = lock ? R_ : 1;
+        const int lock_q = ReadLockQuorum(level);
+
+        // 0) Acquire locks on a read quorum, a write quorum if it may write back (or keep
+        //    the session's)
+        std::vector<int>& locked = locked_;
+        if (lock && !LockForOp(key, lock_q, ReadMode(), locked)) {
+            std::cerr << "GET " << key << " failed: could not acquire " << lock_q << " locks\n";
+            return false;
+        }
+
+        // 1) ReadQuery to locked replicas (every replica if the lock is elsewhere)
+        const std::vector<int>& targets = DataReplicas(locked);
+
+        // offer our cached tag; replicas with nothing newer leave the value out. Our copy
+        // is from a completed op, so it's the floor: only a strictly newer reply beats it.
+        const NearCache::Entry* cached = near_cache_.Find(key);
+        const abd::Tag* max_tag = cached ? &cached->tag : nullptr;
+        const std::string* max_value = cached ? &cached->value : nullptr;
+        bool max_settled = false; // some replica vouches that max_tag is on a write quorum
+        int at_cached = 0;        // replies that still have exactly our copy
+        bool wanted = false;
+        int success_count = 0;
+
+        read_query_->Begin();
+        abd::ReadQueryRequest& query = read_query_->request();
+        query.set_key(key);
+        if (cached) {
+            *query.mutable_cached_tag() = cached->tag;
+        } else {
+            query.clear_cached_tag();
+        }
+        if (lock) {
+            for (int idx : targets) {
+                read_query_->Add(idx, replicas_[idx].stub.get());
+            }
+        } else {
+            for (int i = 0; i < N_; ++i) {
+                read_query_->Add(i, replicas_[i].stub.get());
+            }
+        }
+
+        read_query_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::ReadQueryReply& reply) {
+                if (!ok || !status.ok()) {
+                    std::cerr << "ReadQuery to " << replicas_[idx].address
+                              << " failed for GET " << key << ": "
+                              << (status.ok() ? "stream not ok" : status.error_message())
+                              << "\n";
+                    return;
+                }
+                success_count++;
+                if (reply.lock_wanted()) wanted = true;
+                if (cached && TagEqual(reply.tag(), cached->tag)) at_cached++;
+                // not-modified replies are <= cached, so they never win here
+                if (!max_tag || TagGreater(reply.tag(), *max_tag)) {
+                    max_tag = &reply.tag();
+                    max_value = &reply.value();
+                    max_settled = reply.settled();
+                } else if (reply.settled() && TagEqual(reply.tag(), *max_tag)) {
+                    max_settled = true;
+                }
+            },
+            [&] { return success_count >= quorum; });
+
+        if (cached && max_tag == &cached->tag) {
+            // nobody is past our copy; it only counts as settled while a write quorum of
+            // the replies still has it. Replicas that lost the key (a restart) or are behind
+            // don't vouch for it, whatever `settled` says, and the write-back repairs them.
+            max_settled = at_cached >= W_;
+        }
+        // our own session PUT, which the replicas only hear was settled when we let go
+        if (max_tag && in_session_ && session_key_ == key && have_session_settled_ &&
+            TagEqual(*max_tag, session_settled_)) {
+            max_settled = true;
+        }
+
+        if (success_count < quorum || !max_tag) {
+            std::cerr << "GET " << key
+                      << " failed: did not reach read quorum in ReadQuery phase ("
+                      << success_count << " < " << quorum << ")\n";
+            if (lock) FinishLocked(key, locked, false, nullptr);
+            return false;
+        }
+
+        if (level != Consistency::LINEARIZABLE) {
+            // weaker reads stop at the query; the cache only takes completed values
+            value_out = *max_value;
+            if (lock) FinishLocked(key, locked, !wanted, nullptr);
+            if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                      << " (tag.counter=" << max_tag->counter()
+                      << ", tag.client_id=" << max_tag->client_id()
+                      << ", " << ConsistencyName(level) << ")\n";
+            return true;
+        }
+
+        // The write-back is there so that every later GET sees max_tag or newer. A settled
+        // tag already guarantees that: its PUT got acks from a write quorum before it said
+        // so, tags on a replica only go up, and R + W > N puts one of those replicas in
+        // every later read quorum. Under the locks this is the normal case. Our read locks
+        // exclude the writer's on at least one replica, so every replica that has max_tag
+        // got it from a PUT that already released there. That release came with `settled`
+        // unless the PUT fell short of W (failed or crashed mid-write) or had lost its
+        // lease. Only those GETs still need the write-back.
+        if (max_settled && skip_settled_write_back_) {
+            value_out = *max_value;
+            if (!cached || max_tag != &cached->tag) near_cache_.Update(key, *max_tag, *max_value);
+            FinishLocked(key, locked, !wanted, nullptr);
+            write_backs_skipped_++;
+            if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                      << " (tag.counter=" << max_tag->counter()
+                      << ", tag.client_id=" << max_tag->client_id() << ", settled)\n";
+            return true;
+        }
+
+        RenewLeasesIfDue(key, locked);
+
+        // 2) Write-back via WriteProp to the replicas we queried (ABD-style)
+        abd::WritePropRequest& req = write_prop_->request();
+        req.set_key(key);
+        *req.mutable_tag() = *max_tag;
+        req.set_value(*max_value);
+
+        int ack_count = WritePropRound(key, targets, W_, true);
+
+        // 3) Release locks before returning; a completed write-back settles max_tag
+        FinishLocked(key, locked, ack_count >= W_ && !wanted, ack_count >= W_ ? &req.tag() : nullptr);
+
+        if (ack_count < W_) {
+            std::cerr << "GET " << key
+                      << " failed: did not reach write quorum in WriteProp phase ("
+                      << ack_count << " < " << W_ << ")\n";
+            return false;
+        }
+
+        value_out = req.value();
+        if (!cached || max_tag != &cached->tag) near_cache_.Update(key, req.tag(), req.value());
+        if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                  << " (tag.counter=" << req.tag().counter()
+                  << ", tag.client_id=" << req.tag().client_id() << ")\n";
+        return true;
+    }
+
+    // no single-phase API, so ShardedClient can't migrate keys under the lock protocol
+    static constexpr bool kDualRoute = false;
+
+private:
+    struct Replica {
+        std::string address;
+        std::shared_ptr<grpc::Channel> channel;
+        std::unique_ptr<abd::ABDService::Stub> stub;
+        std::unique_ptr<grpc::GenericStub> generic_stub; // pre-serialized WriteProp
+    };
+
+    static bool TagGreater(const abd::Tag& a, const abd::Tag& b)
+    {
+        if (a.counter() != b.counter()) return a.counter() > b.counter();
+        return a.client_id() > b.client_id();
+    }
+
+    static bool TagEqual(const abd::Tag& a, const abd::Tag& b)
+    {
+        return a.counter() == b.counter() && a.client_id() == b.client_id();
+    }
+
+    void InitQuorums()
+    {
+        N_ = static_cast<int>(replicas_.size());
+        R_ = N_ / 2 + 1;
+        W_ = N_ / 2 + 1;
+        write_query_.reset(new WriteQueryCall(N_));
+        read_query_.reset(new ReadQueryCall(N_));
+        write_prop_.reset(new WritePropCall(N_));
+        acquire_lock_.reset(new AcquireLockCall(N_));
+        release_.reset(new ReleaseLockCall(N_));
+        withdraw_.reset(new ReleaseLockCall(N_));
+        acquire_query_.reset(new AcquireAndQueryCall(N_));
+        prop_release_.reset(new PropAndReleaseCall(N_));
+        acquire_locks_.reset(new AcquireLocksCall(N_));
+        release_batch_.reset(new ReleaseLocksCall(N_));
+        withdraw_batch_.reset(new ReleaseLocksCall(N_));
+        locked_.reserve(N_);
+        answered_.resize(N_);
+        std::vector<std::string> addrs;
+        for (int i = 0; i < N_; ++i) {
+            addrs.push_back(replicas_[i].address);
+            all_replicas_.push_back(i);
+        }
+        lock_ring_.reset(new HashRing(addrs));
+    }
+
+    // WriteQuery to the locked replicas: the highest tag among a write quorum of them, and
+    // whether any of them says someone else wants the lock. False (and says why) if fewer
+    // than W answered.
+    bool WriteQueryRound(const std::string& key, const std::vector<int>& locked, abd::Tag& max_tag, bool& wanted)
+    {
+        max_tag.set_counter(0);
+        max_tag.set_client_id("");
+        bool have_tag = false;
+        int success_count = 0;
+
+        write_query_->Begin();
+        write_query_->request().set_key(key);
+        for (int idx : locked) {
+            write_query_->Add(idx, replicas_[idx].stub.get());
+        }
+
+        write_query_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::WriteQueryReply& reply) {
+                if (!ok || !status.ok()) {
+                    std::cerr << "WriteQuery to " << replicas_[idx].address
+                              << " failed for PUT " << key << ": "
+                              << (status.ok() ? "stream not ok" : status.error_message())
+                              << "\n";
+                    return;
+                }
+                success_count++;
+                if (reply.lock_wanted()) wanted = true;
+                const abd::Tag& t = reply.tag();
+                if (!have_tag || TagGreater(t, max_tag)) {
+                    max_tag = t;
+                    have_tag = true;
+                }
+            },
+            [&] { return success_count >= W_; });
+
+        if (success_count < W_) {
+            std::cerr << "PUT " << key
+                      << " failed: did not reach write quorum in WriteQuery phase ("
+                      << success_count << " < " << W_ << ")\n";
+            return false;
+        }
+        return true;
+    }
+
+    // Sends write_prop_->request() (already filled in) to the locked replicas, returns
+    // #acks once `quorum` of them have acked or all have answered
+    int WritePropRound(const std::string& key, const std::vector<int>& locked, int quorum, bool write_back)
+    {
+        int ack_count = 0;
+        write_prop_->request().set_fence(coordinator_locks_ ? fence_ : 0);
+        write_prop_->Begin();
+        for (int idx : locked) {
+            write_prop_->Add(idx, replicas_[idx].generic_stub.get());
+        }
+        write_prop_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::Ack& reply) {
+                if (ok && status.ok() && reply.fenced()) fenced_writes_++;
+                if (!ok || !status.ok() || !reply.ok()) {
+                    std::cerr << (write_back ? "WriteProp (read write-back) to " : "WriteProp to ")
+                              << replicas_[idx].address
+                              << " failed for " << (write_back ? "GET " : "PUT ") << key << ": "
+                              << (status.ok() ? (reply.fenced() ? reply.error() : "NOK Ack or stream not ok")
+                                              : status.error_message())
+                              << "\n";
+                    return;
+                }
+                ack_count++;
+            },
+            [&] { return ack_count >= quorum; });
+        return ack_count;
+    }
+
+    // Acquire locks on a quorum q; block/retry until we have them.
+    // First every replica is asked at once and nobody queues: uncontended, that's the only
+    // round. Otherwise the rest goes in replica order. We keep the grants below the first
+    // replica we didn't get, give back the ones above it, and take the remaining replicas
+    // one at a time, queued server-side (lock_wait_ms_ > 0) or polled with backoff. Nobody
+    // ever waits on a replica while holding one further up the order, so clients after the
+    // same key can't each end up with a minority, waiting on each other until a lease runs
+    // out (what asking everyone and keeping whatever came back used to do under load).
+    bool AcquireQuorumLocks(const std::string& key, int q, abd::LockMode mode, std::vector<int>& locked_indices)
+    {
+        return AcquireQuorumLocks(*acquire_lock_, acquire_lock_->request(), key, q, mode, locked_indices);
+    }
+
+    // The protocol itself, over plain AcquireLock or (fused) AcquireAndQuery: `req` is the
+    // lock part of call.request(). Granted replicas aren't sent to again, so call.reply(i)
+    // of each locked replica i is its grant until the next acquire.
+    template <typename Call>
+    bool AcquireQuorumLocks(Call& call, abd::AcquireLockRequest& req, const std::string& key, int q,
+                            abd::LockMode mode, std::vector<int>& locked_indices)
+    {
+        locked_indices.clear();
+        req.set_key(key);
+        req.set_mode(mode);
+        lock_mode_ = mode;
+        req.set_client_id(client_id_);
+        req.set_seq(lock_seq_ = NextLockSeq());
+        req.set_lease_ms(LeaseToAsk());
+        const bool queued = lock_wait_ms_ > 0 && Queues(call.request());
+        // leases start when each replica grants, which is after this: safe to count from here
+        lease_start_ = std::chrono::steady_clock::now();
+        lease_granted_ms_ = 0;
+        bool contended = false;
+        lock_acquires_++;
+        backoff_.Reset();
+
+        for (;;) {
+            // 1) Every replica we don't hold yet, at once, without queueing
+            req.set_wait_ms(0);
+            call.Begin();
+            for (int i = 0; i < N_; ++i) {
+                answered_[i] = Holds(locked_indices, i);
+                if (answered_[i]) continue;
+                call.Add(i, replicas_[i].stub.get());
+                lock_rpcs_++;
+            }
+            // polling can't stop early: a grant we stopped listening for would never be
+            // released. Queued mode withdraws the stragglers instead.
+            call.Wait(
+                [&](int idx, bool ok, const grpc::Status& status, const auto& full_reply) {
+                    answered_[idx] = true;
+                    OnLockReply(key, idx, ok, status, LockPart(full_reply), locked_indices);
+                },
+                [&] { return queued && static_cast<int>(locked_indices.size()) >= q; });
+
+            if (static_cast<int>(locked_indices.size()) >= q) {
+                if (queued) WithdrawStragglers(key);
+                return true;
+            }
+            if (!contended) {
+                contended = true;
+                ordered_acquires_++;
+            }
+
+            // 2) In replica order from the first one we didn't get
+            int first = 0;
+            while (first < N_ && Holds(locked_indices, first)) ++first;
+            DropLocksAbove(call.request(), key, first, req, locked_indices);
+            req.set_wait_ms(static_cast<uint32_t>(queued ? lock_wait_ms_ : 0));
+            for (int i = first; i < N_ && static_cast<int>(locked_indices.size()) < q; ++i) {
+                for (;;) {
+                    bool granted = false;
+                    bool failed = false;
+                    call.Begin();
+                    call.Add(i, replicas_[i].stub.get());
+                    lock_rpcs_++;
+                    call.Wait(
+                        [&](int idx, bool ok, const grpc::Status& status, const auto& full_reply) {
+                            const abd::AcquireLockReply& reply = LockPart(full_reply);
+                            failed = !ok || !status.ok();
+                            granted = OnLockReply(key, idx, ok, status, reply, locked_indices);
+                            if (!failed && !granted) backoff_.Observe(reply.holder());
+                        },
+                        Call::Never);
+                    if (granted || failed) break; // failed: unreachable, go on with the next one
+                    // held (queued: for all of lock_wait_ms_); we still only hold replicas
+                    // below this one, so waiting here can't close a cycle
+                    lock_retries_++;
+                    if (!queued) std::this_thread::sleep_for(backoff_.Next());
+                }
+            }
+            if (static_cast<int>(locked_indices.size()) >= q) return true;
+
+            // too few replicas answering; what we kept is a prefix, start over from there
+            lock_retries_++;
+            std::this_thread::sleep_for(backoff_.Next());
+        }
+    }
+
+    // Acquire seqs come from one counter for the whole process, so no two client objects
+    // ever send the same (client_id, seq) pair and a withdrawal can only cancel the
+    // attempt it was meant for, whatever the client ids are.
+    static uint64_t NextLockSeq()
+    {
+        static std::atomic<uint64_t> next{0};
+        return ++next;
+    }
+
+    static bool Holds(const std::vector<int>& locked_indices, int replica)
+    {
+        return std::find(locked_indices.begin(), locked_indices.end(), replica) != locked_indices.end();
+    }
+
+    // One AcquireLock answer; true if it granted
+    bool OnLockReply(const std::string& key, int idx, bool ok, const grpc::Status& status,
+                     const abd::AcquireLockReply& reply, std::vector<int>& locked_indices)
+    {
+        if (!ok || !status.ok()) {
+            std::cerr << "AcquireLock to " << replicas_[idx].address
+                      << " failed for key " << key << ": "
+                      << (status.ok() ? "stream not ok" : status.error_message())
+                      << "\n";
+            return false;
+        }
+        // not granted: held by someone else, this is where blocking semantics come from
+        if (!reply.granted()) return false;
+        locked_indices.push_back(idx);
+        if (lease_granted_ms_ == 0 || reply.lease_ms() < lease_granted_ms_) {
+            lease_granted_ms_ = reply.lease_ms();
+        }
+        return true;
+    }
+
+    // Batches never park server-side (see AcquireLocks), their held keys are polled
+    template <typename Request>
+    static bool Queues(const Request&) { return true; }
+    static bool Queues(const abd::AcquireLocksRequest&) { return false; }
+
+    // Gives back our holds on replicas past `first`, fire and forget like
+    // WithdrawStragglers, and moves `req` on to a new attempt number so the withdrawal
+    // can't cancel what we ask those replicas for next.
+    template <typename Request>
+    void DropLocksAbove(const Request&, const std::string& key, int first, abd::AcquireLockRequest& req,
+                        std::vector<int>& locked_indices)
+    {
+        withdraw_->Begin();
+        abd::ReleaseLockRequest& rel = withdraw_->request();
+        rel.set_key(key);
+        rel.set_client_id(client_id_);
+        rel.set_cancel_seq(lock_seq_);
+        DropAbove(*withdraw_, first, locked_indices);
+        req.set_seq(lock_seq_ = NextLockSeq());
+    }
+
+    // same for a batch, all of its keys
+    void DropLocksAbove(const abd::AcquireLocksRequest& batch, const std::string&, int first,
+                        abd::AcquireLockRequest& req, std::vector<int>& locked_indices)
+    {
+        withdraw_batch_->Begin();
+        abd::ReleaseLocksRequest& rel = withdraw_batch_->request();
+        *rel.mutable_keys() = batch.keys();
+        rel.mutable_lock()->set_client_id(client_id_);
+        rel.mutable_lock()->set_cancel_seq(lock_seq_);
+        DropAbove(*withdraw_batch_, first, locked_indices);
+        req.set_seq(lock_seq_ = NextLockSeq());
+    }
+
+    template <typename Call>
+    void DropAbove(Call& withdraw, int first, std::vector<int>& locked_indices)
+    {
+        for (auto it = locked_indices.begin(); it != locked_indices.end();) {
+            if (*it > first) {
+                withdraw.Add(*it, replicas_[*it].stub.get());
+                it = locked_indices.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Re-acquiring a lock we hold renews its lease. Past half the (shortest) lease we got,
+    // renew on every locked replica before going on. A replica that says no has already
+    // given the lock away; mid-op we carry on regardless, the phases are plain ABD and stay
+    // safe by tags, we just aren't exclusive there any more. False if that happened.
+    bool RenewLeasesIfDue(const std::string& key, const std::vector<int>& locked)
+    {
+        if (!LeaseRenewalDue()) return true;
+        bool kept = true;
+
+        acquire_lock_->Begin();
+        abd::AcquireLockRequest& req = acquire_lock_->request();
+        req.set_key(key);
+        req.set_client_id(client_id_);
+        req.set_wait_ms(0);
+        req.set_seq(lock_seq_);
+        req.set_lease_ms(LeaseToAsk());
+        req.set_mode(lock_mode_);
+        for (int idx : locked) acquire_lock_->Add(idx, replicas_[idx].stub.get());
+        lease_start_ = std::chrono::steady_clock::now();
+        lease_renewals_++;
+        acquire_lock_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::AcquireLockReply& reply) {
+                if (!ok || !status.ok() || !reply.granted()) {
+                    kept = false;
+                    std::cerr << "Lease renewal at " << replicas_[idx].address << " failed for key " << key
+                              << ": " << (status.ok() ? "now held by " + reply.holder() : status.error_message())
+                              << "\n";
+                }
+            },
+            AcquireLockCall::Never);
+        return kept;
+    }
+
+    bool LeaseRenewalDue() const
+    {
+        return lease_granted_ms_ != 0 &&
+               std::chrono::steady_clock::now() - lease_start_ >= std::chrono::milliseconds(lease_granted_ms_ / 2);
+    }
+
+    // RenewLeasesIfDue for a batch: the same AcquireLocks again, which renews every key
+    void RenewBatchLeasesIfDue(const std::string& label, const std::vector<int>& locked)
+    {
+        if (!LeaseRenewalDue()) return;
+        acquire_locks_->Begin();
+        acquire_locks_->request().mutable_lock()->set_wait_ms(0);
+        for (int idx : locked) acquire_locks_->Add(idx, replicas_[idx].stub.get());
+        lease_start_ = std::chrono::steady_clock::now();
+        lease_renewals_++;
+        acquire_locks_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::AcquireLocksReply& reply) {
+                if (!ok || !status.ok() || !reply.lock().granted()) {
+                    std::cerr << "Lease renewal at " << replicas_[idx].address << " failed for " << label
+                              << ": " << (status.ok() ? reply.blocked_key() + " now held by " + reply.lock().holder()
+                                                      : status.error_message())
+                              << "\n";
+                }
+            },
+            AcquireLocksCall::Never);
+    }
+
+    // A linearizable GET's write-back is a write and has to reach W replicas like one, and
+    // it only goes where we hold locks. So those GETs lock max(R, W); weaker reads never
+    // write back and lock R.
+    int ReadLockQuorum(Consistency level) const
+    {
+        return level == Consistency::LINEARIZABLE ? std::max(R_, W_) : R_;
+    }
+
+    // Session leases are the idle timeout, see SetLockSessions
+    uint32_t LeaseToAsk() const
+    {
+        return static_cast<uint32_t>(Sessions() ? session_idle_ms_ : lease_ms_);
+    }
+
+    bool Sessions() const { return session_idle_ms_ > 0 && !fused_; }
+
+    // The locks for one op: the session's if they cover it (same key, a mode at least as
+    // strong, enough replicas, leases still ours), else a fresh acquire, after handing
+    // back the session's locks if there were any
+    bool LockForOp(const std::string& key, int q, abd::LockMode mode, std::vector<int>& locked)
+    {
+        if (coordinator_locks_) q = 1;
+        if (in_session_) {
+            if (session_key_ == key && (mode == abd::SHARED || lock_mode_ == abd::EXCLUSIVE) &&
+                static_cast<int>(locked.size()) >= q && RenewLeasesIfDue(key, locked)) {
+                session_ops_++;
+                return true;
+            }
+            EndSession();
+        }
+        if (coordinator_locks_) return AcquireCoordinatorLock(key, mode, locked);
+        return AcquireQuorumLocks(key, q, mode, locked);
+    }
+
+    // Where an op's query and propagation go: the locked quorum, or with a lock coordinator
+    // every replica (whichever R/W answer first)
+    const std::vector<int>& DataReplicas(const std::vector<int>& locked) const
+    {
+        return coordinator_locks_ ? all_replicas_ : locked;
+    }
+
+    // Lock coordinator mode (see SetLockCoordinator): the one replica that has key's lock
+    int LockCoordinator(const std::string& key) const { return lock_ring_->GroupFor(key); }
+
+    // One AcquireLock to the key's coordinator, queued or polled with backoff until it
+    // grants. Its epoch goes on our writes until the next acquire. A coordinator that
+    // doesn't answer fails the op: there is no other replica to take this key's lock from.
+    bool AcquireCoordinatorLock(const std::string& key, abd::LockMode mode, std::vector<int>& locked)
+    {
+        locked.clear();
+        const int c = LockCoordinator(key);
+        abd::AcquireLockRequest& req = acquire_lock_->request();
+        req.set_key(key);
+        req.set_mode(mode);
+        lock_mode_ = mode;
+        req.set_client_id(client_id_);
+        req.set_seq(lock_seq_ = NextLockSeq());
+        req.set_lease_ms(LeaseToAsk());
+        req.set_wait_ms(static_cast<uint32_t>(lock_wait_ms_));
+        lease_start_ = std::chrono::steady_clock::now();
+        lease_granted_ms_ = 0;
+        lock_acquires_++;
+        backoff_.Reset();
+
+        for (;;) {
+            bool granted = false;
+            bool failed = false;
+            acquire_lock_->Begin();
+            acquire_lock_->Add(c, replicas_[c].stub.get());
+            lock_rpcs_++;
+            acquire_lock_->Wait(
+                [&](int idx, bool ok, const grpc::Status& status, const abd::AcquireLockReply& reply) {
+                    failed = !ok || !status.ok();
+                    granted = OnLockReply(key, idx, ok, status, reply, locked);
+                    if (granted) {
+                        fence_ = reply.fence();
+                    } else if (!failed) {
+                        backoff_.Observe(reply.holder());
+                    }
+                },
+                AcquireLockCall::Never);
+            if (granted) return true;
+            if (failed) return false;
+            lock_retries_++;
+            if (lock_wait_ms_ == 0) std::this_thread::sleep_for(backoff_.Next());
+        }
+    }
+
+    // End of a locked op. In session mode the locks stay if the op went through and
+    // nobody else asked for them (`keep`); otherwise they're released, with the tag this
+    // op got onto a write quorum if any (`settled`, see Get). A session PUT's settled tag
+    // only reaches the replicas with the release, until then we vouch for it ourselves.
+    void FinishLocked(const std::string& key, const std::vector<int>& locked, bool keep, const abd::Tag* settled)
+    {
+        if (settled) {
+            session_settled_ = *settled;
+            have_session_settled_ = true;
+        }
+        if (keep && Sessions()) {
+            in_session_ = true;
+            session_key_ = key;
+            return;
+        }
+        in_session_ = false;
+        ReleaseLocks(key, locked, have_session_settled_ ? &session_settled_ : nullptr);
+        have_session_settled_ = false;
+    }
+
+    // ReleaseLock with cancel_seq to every replica whose answer we didn't wait for: drops
+    // the grant if it already happened, takes us out of the queue if we're in it, and
+    // refuses the request later if it hasn't even arrived yet. Fire and forget, the
+    // replies are reaped by the next round's Begin().
+    void WithdrawStragglers(const std::string& key)
+    {
+        withdraw_->Begin();
+        abd::ReleaseLockRequest& req = withdraw_->request();
+        req.set_key(key);
+        req.set_client_id(client_id_);
+        req.set_cancel_seq(lock_seq_);
+        for (int i = 0; i < N_; ++i) {
+            if (!answered_[i]) withdraw_->Add(i, replicas_[i].stub.get());
+        }
+    }
+
+    // All locked replicas at once, one round trip whatever the quorum size. `settled`:
+    // the tag this op got onto a write quorum, if any (see Get)
+    void ReleaseLocks(const std::string& key, const std::vector<int>& locked_indices,
+                      const abd::Tag* settled = nullptr)
+    {
+        release_->Begin();
+        abd::ReleaseLockRequest& req = release_->request();
+        req.set_key(key);
+        req.set_client_id(client_id_);
+        if (settled) {
+            *req.mutable_settled() = *settled;
+        } else {
+            req.clear_settled();
+        }
+        for (int idx : locked_indices) {
+            release_->Add(idx, replicas_[idx].stub.get());
+        }
+        release_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::ReleaseLockReply& rep) {
+                if (ok && status.ok() && !rep.ok()) leases_lost_++;
+                if (!ok || !status.ok() || !rep.ok()) {
+                    std::cerr << "ReleaseLock to " << replicas_[idx].address
+                              << " failed for key " << key << ": "
+                              << (status.ok() ? "Reply not ok" : status.error_message())
+                              << "\n";
+                }
+            },
+            ReleaseLockCall::Never);
+    }
+
+    // ReleaseLocks of a batch's keys (acquire_locks_->request()) on every locked replica,
+    // one round trip. settled[i]: the tag the i-th key (in key order) got onto a write
+    // quorum; a failed MultiPut has fewer.
+    void ReleaseBatch(const std::string& label, const std::vector<int>& locked_indices,
+                      const std::vector<abd::Tag>& settled)
+    {
+        release_batch_->Begin();
+        abd::ReleaseLocksRequest& req = release_batch_->request();
+        *req.mutable_keys() = acquire_locks_->request().keys();
+        req.mutable_lock()->set_client_id(client_id_);
+        req.clear_settled();
+        for (const abd::Tag& t : settled) *req.add_settled() = t;
+        for (int idx : locked_indices) {
+            release_batch_->Add(idx, replicas_[idx].stub.get());
+        }
+        release_batch_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::ReleaseLockReply& rep) {
+                if (ok && status.ok() && !rep.ok()) leases_lost_++;
+                if (!ok || !status.ok() || !rep.ok()) {
+                    std::cerr << "ReleaseLocks to " << replicas_[idx].address
+                              << " failed for " << label << ": "
+                              << (status.ok() ? "Reply not ok" : status.error_message())
+                              << "\n";
+                }
+            },
+            ReleaseLocksCall::Never);
+    }
+
+    abd::LockMode ReadMode() const { return shared_reads_ ? abd::SHARED : abd::EXCLUSIVE; }
+
+    static const abd::AcquireLockReply& LockPart(const abd::AcquireLockReply& reply) { return reply; }
+    static const abd::AcquireLockReply& LockPart(const abd::AcquireAndQueryReply& reply) { return reply.lock(); }
+    static const abd::AcquireLockReply& LockPart(const abd::AcquireLocksReply& reply) { return reply.lock(); }
+
+    bool FusedPut(const std::string& key, const std::string& value)
+    {
+        // 0+1) Lock a write quorum, each grant comes with that replica's tag
+        std::vector<int>& locked = locked_;
+        abd::AcquireAndQueryRequest& query = acquire_query_->request();
+        query.set_want_value(false);
+        query.clear_cached_tag();
+        if (!AcquireQuorumLocks(*acquire_query_, *query.mutable_lock(), key, W_, abd::EXCLUSIVE, locked)) {
+            std::cerr << "PUT " << key << " failed: could not acquire " << W_ << " locks\n";
+            return false;
+        }
+        abd::Tag max_tag;
+        for (int idx : locked) {
+            const abd::Tag& t = acquire_query_->reply(idx).query().tag();
+            if (TagGreater(t, max_tag)) max_tag = t;
+        }
+
+        RenewLeasesIfDue(key, locked);
+
+        // 2+3) New tag, WriteProp and unlock
+        abd::PropAndReleaseRequest& pr = prop_release_->request();
+        pr.set_client_id(client_id_);
+        abd::WritePropRequest& req = *pr.mutable_prop();
+        req.set_key(key);
+        req.mutable_tag()->set_counter(max_tag.counter() + 1);
+        req.mutable_tag()->set_client_id(client_id_);
+        req.set_value(value);
+
+        int ack_count = PropAndReleaseRound(key, locked, false);
+        if (ack_count < W_) {
+            std::cerr << "PUT " << key
+                      << " failed: did not reach write quorum in PropAndRelease phase ("
+                      << ack_count << " < " << W_ << ")\n";
+            return false;
+        }
+
+        near_cache_.Update(key, req.tag(), value);
+        if (verbose_) std::cout << " PUT " << key << " = " << value
+                  << " (tag.counter=" << req.tag().counter()
+                  << ", tag.client_id=" << req.tag().client_id() << ", fused)\n";
+        return true;
+    }
+
+    bool FusedGet(const std::string& key, std::string& value_out, Consistency level)
+    {
+        // 0+1) Lock a read quorum (see ReadLockQuorum), each grant comes with that replica's
+        //      (tag, value)
+        std::vector<int>& locked = locked_;
+        const NearCache::Entry* cached = near_cache_.Find(key);
+        abd::AcquireAndQueryRequest& query = acquire_query_->request();
+        query.set_want_value(true);
+        if (cached) {
+            *query.mutable_cached_tag() = cached->tag;
+        } else {
+            query.clear_cached_tag();
+        }
+        const int lock_q = ReadLockQuorum(level);
+        if (!AcquireQuorumLocks(*acquire_query_, *query.mutable_lock(), key, lock_q, ReadMode(), locked)) {
+            std::cerr << "GET " << key << " failed: could not acquire " << lock_q << " locks\n";
+            return false;
+        }
+        // our copy is the floor, as in Get; not-modified replies are <= it and never win
+        const abd::Tag* max_tag = cached ? &cached->tag : nullptr;
+        const std::string* max_value = cached ? &cached->value : nullptr;
+        for (int idx : locked) {
+            const abd::ReadQueryReply& q = acquire_query_->reply(idx).query();
+            if (!max_tag || TagGreater(q.tag(), *max_tag)) {
+                max_tag = &q.tag();
+                max_value = &q.value();
+            }
+        }
+        if (!max_tag) {
+            std::cerr << "GET " << key << " failed: no query result with the locks\n";
+            ReleaseLocks(key, locked);
+            return false;
+        }
+
+        if (level != Consistency::LINEARIZABLE) {
+            value_out = *max_value;
+            ReleaseLocks(key, locked);
+            if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                      << " (tag.counter=" << max_tag->counter()
+                      << ", tag.client_id=" << max_tag->client_id()
+                      << ", " << ConsistencyName(level) << ", fused)\n";
+            return true;
+        }
+
+        RenewLeasesIfDue(key, locked);
+
+        // 2+3) Write-back and unlock
+        abd::PropAndReleaseRequest& pr = prop_release_->request();
+        pr.set_client_id(client_id_);
+        abd::WritePropRequest& req = *pr.mutable_prop();
+        req.set_key(key);
+        *req.mutable_tag() = *max_tag;
+        req.set_value(*max_value);
+        const bool from_cache = cached && max_tag == &cached->tag;
+
+        int ack_count = PropAndReleaseRound(key, locked, true);
+        if (ack_count < W_) {
+            std::cerr << "GET " << key
+                      << " failed: did not reach write quorum in PropAndRelease phase ("
+                      << ack_count << " < " << W_ << ")\n";
+            return false;
+        }
+
+        value_out = req.value();
+        if (!from_cache) near_cache_.Update(key, req.tag(), req.value());
+        if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                  << " (tag.counter=" << req.tag().counter()
+                  << ", tag.client_id=" << req.tag().client_id() << ", fused)\n";
+        return true;
+    }
+
+    // prop_release_->request() (already filled in) to every locked replica. Everyone is
+    // waited for: the reply is also how we learn the lock went.
+    int PropAndReleaseRound(const std::string& key, const std::vector<int>& locked, bool write_back)
+    {
+        int ack_count = 0;
+        prop_release_->Begin();
+        for (int idx : locked) {
+            prop_release_->Add(idx, replicas_[idx].generic_stub.get());
+        }
+        prop_release_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::PropAndReleaseReply& reply) {
+                if (!ok || !status.ok() || !reply.ack().ok()) {
+                    std::cerr << "PropAndRelease to " << replicas_[idx].address
+                              << " failed for " << (write_back ? "GET " : "PUT ") << key << ": "
+                              << (status.ok() ? "NOK Ack or stream not ok" : status.error_message())
+                              << "\n";
+                    return;
+                }
+                if (!reply.released()) leases_lost_++;
+                ack_count++;
+            },
+            PropAndReleaseCall::Never);
+        return ack_count;
+    }
+
+    std::vector<Replica> replicas_;
+    int N_ = 0;
+    int R_ = 0;
+    int W_ = 0;
+    std::string client_id_;
+    bool verbose_ = true;
+    NearCache near_cache_;
+
+    // one reusable round per phase type (see QuorumCall.h)
+    std::unique_ptr<WriteQueryCall> write_query_;
+    std::unique_ptr<ReadQueryCall> read_query_;
+    std::unique_ptr<WritePropCall> write_prop_;
+    std::unique_ptr<AcquireLockCall> acquire_lock_;
+    std::unique_ptr<ReleaseLockCall> release_;
+    std::unique_ptr<ReleaseLockCall> withdraw_;
+    std::unique_ptr<AcquireAndQueryCall> acquire_query_;
+    std::unique_ptr<PropAndReleaseCall> prop_release_;
+    std::unique_ptr<AcquireLocksCall> acquire_locks_;
+    std::unique_ptr<ReleaseLocksCall> release_batch_;
+    std::unique_ptr<ReleaseLocksCall> withdraw_batch_;
+    std::vector<int> locked_;
+    std::vector<bool> answered_; // per replica, this acquire round
+    std::vector<int> all_replicas_;
+
+    bool coordinator_locks_ = false;
+    std::unique_ptr<HashRing> lock_ring_; // over replica addresses, picks a key's lock coordinator
+    uint64_t fence_ = 0;                  // epoch of the coordinator lock we hold
+    long fenced_writes_ = 0;
+
+    int lock_wait_ms_ = 0;
+    uint64_t lock_seq_ = 0; // last acquire seq sent, from NextLockSeq()
+    long lock_rpcs_ = 0;
+    long ordered_acquires_ = 0;
+    long lock_acquires_ = 0;
+    long lock_retries_ = 0;
+    Backoff backoff_{std::chrono::microseconds(200), std::chrono::microseconds(20000), std::random_device{}()};
+
+    bool fused_ = false;
+    bool shared_reads_ = true;
+    bool skip_settled_write_back_ = true;
+
+    int session_idle_ms_ = 0;
+    bool in_session_ = false;   // locked_ still holds session_key_ (lock_mode_) from the last op
+    std::string session_key_;
+    abd::Tag session_settled_;  // latest tag our session PUTs got onto a write quorum
+    bool have_session_settled_ = false;
+    long session_ops_ = 0;
+    long multi_puts_ = 0;
+    long multi_put_keys_ = 0;
+    long write_backs_skipped_ = 0;
+    abd::LockMode lock_mode_ = abd::EXCLUSIVE; // of the locks we hold, for renewals
+    int lease_ms_ = 0;
+    uint32_t lease_granted_ms_ = 0; // shortest lease granted for the locks we hold now
+    std::chrono::steady_clock::time_point lease_start_;
+    long lease_renewals_ = 0;
+    long leases_lost_ = 0;
+};
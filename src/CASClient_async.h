@@ -0,0 +1,269 @@
+#pragma once
+
+#include "proto/abd.grpc.pb.h"
+#include "proto/abd.pb.h"
+#include "src/Consistency.h"
+#include "src/QuorumCall.h"
+#include "src/ReedSolomon.h"
+#include <grpcpp/grpcpp.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <sys/types.h>
+#include <unistd.h>
+#include <vector>
+
+using CasQueryCall = QuorumCall<abd::CasQueryRequest, abd::CasQueryReply,
+                                TypedRpc<abd::CasQueryRequest, abd::CasQueryReply,
+                                         &abd::ABDService::Stub::PrepareAsyncCasQuery>>;
+// typed on purpose: every replica gets a different fragment, and gRPC serializing inside
+// Add() is what lets us swap it between Adds
+using CasPreWriteCall = QuorumCall<abd::CasPreWriteRequest, abd::Ack,
+                                   TypedRpc<abd::CasPreWriteRequest, abd::Ack,
+                                            &abd::ABDService::Stub::PrepareAsyncCasPreWrite>>;
+using CasFinalizeCall = QuorumCall<abd::CasFinalizeRequest, abd::CasFinalizeReply,
+                                   TypedRpc<abd::CasFinalizeRequest, abd::CasFinalizeReply,
+                                            &abd::ABDService::Stub::PrepareAsyncCasFinalize>>;
+
+// Erasure-coded atomic register, CAS/CASGC (Cadambe, Lynch, Medard, Musial). Each value is
+// Reed-Solomon coded into N fragments of size/k, replica i stores fragment i, so a PUT
+// ships and stores ~N/k copies' worth instead of N. The price is a bigger quorum: any two
+// quorums have to share k replicas (enough to decode), so q = ceil((N + k) / 2), and the
+// group only survives N - q failures.
+//
+//   PUT: query q for the highest finalized tag -> pre-write fragment i to replica i with
+//        tag+1, wait for q -> finalize the tag on q
+//   GET: query q for the highest finalized tag -> finalize it on q, which also returns
+//        fragments; done once q have answered and k of them had a fragment
+//
+// A reader only asks for tags a quorum has finalized, and a tag is only finalized after
+// its fragments are on q replicas, so any q replies contain k fragments unless the server
+// already garbage collected them (more than --cas-delta writes overlapping the read); the
+// GET fails then rather than return anything older.
+//
+// Same interface as ABDClient so ShardedClient / the load driver can run it. Its keys live
+// in the servers' CAS table, separate from the ABD one.
+class CASClient {
+public:
+    explicit CASClient(const std::vector<std::string>& server_addrs)
+    {
+        for (const auto& addr : server_addrs) {
+            std::shared_ptr<grpc::Channel> ch = grpc::CreateChannel(addr, grpc::InsecureChannelCredentials());
+            replicas_.push_back({addr, abd::ABDService::NewStub(ch)});
+            std::cout << "CASClient connecting to " << addr << "\n";
+        }
+        Init();
+        client_id_ = std::to_string(getpid());
+    }
+
+    CASClient(const std::vector<std::string>& server_addrs,
+              const std::vector<std::shared_ptr<grpc::Channel>>& channels,
+              const std::string& client_id)
+    {
+        for (size_t i = 0; i < server_addrs.size(); ++i) {
+            replicas_.push_back({server_addrs[i], abd::ABDService::NewStub(channels[i])});
+        }
+        Init();
+        client_id_ = client_id;
+    }
+
+    static constexpr bool kDualRoute = false;
+
+    void SetVerbose(bool verbose) { verbose_ = verbose; }
+
+    // k data fragments out of N; defaults to DefaultDataFragments(N)
+    void SetDataFragments(int k)
+    {
+        k_ = k;
+        code_.reset(new ReedSolomon(N_, k_));
+        Q_ = (N_ + k_ + 1) / 2;
+    }
+    int DataFragments() const { return k_; }
+    int Quorum() const { return Q_; }
+
+    // N - 2, the most fragments that still leave one failure tolerated. Below N = 4 that
+    // is k = 1, which isn't coding at all (every fragment is the whole value); the load
+    // driver refuses it rather than report replication as erasure coding.
+    static int DefaultDataFragments(int n) { return n > 2 ? n - 2 : 1; }
+
+    // R/W don't apply, the quorum follows from N and k
+    void SetQuorums(int, int) {}
+
+    // bytes of values PUT vs bytes of fragments sent for them (what replicas store too)
+    long ValueBytes() const { return value_bytes_; }
+    long FragmentBytes() const { return fragment_bytes_; }
+
+    bool Put(const std::string& key, const std::string& value)
+    {
+        abd::Tag tag;
+        if (!QueryTag(key, tag)) {
+            std::cerr << "PUT " << key << " failed: no quorum in CAS query\n";
+            return false;
+        }
+        tag.set_counter(tag.counter() + 1);
+        tag.set_client_id(client_id_);
+
+        code_->Encode(value, fragments_);
+        int acks = 0;
+        pre_write_->Begin();
+        abd::CasPreWriteRequest& req = pre_write_->request();
+        req.set_key(key);
+        *req.mutable_tag() = tag;
+        req.set_value_size(static_cast<uint32_t>(value.size()));
+        for (int i = 0; i < N_; ++i) {
+            req.set_fragment(fragments_[i]);
+            pre_write_->Add(i, replicas_[i].stub.get());
+            fragment_bytes_ += static_cast<long>(fragments_[i].size());
+        }
+        value_bytes_ += static_cast<long>(value.size());
+        pre_write_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::Ack& reply) {
+                if (!ok || !status.ok() || !reply.ok()) {
+                    std::cerr << "CasPreWrite to " << replicas_[idx].address << " failed for PUT " << key
+                              << ": " << (status.ok() ? "NOK Ack or stream not ok" : status.error_message())
+                              << "\n";
+                    return;
+                }
+                acks++;
+            },
+            [&] { return acks >= Q_; });
+        if (acks < Q_) {
+            std::cerr << "PUT " << key << " failed: pre-write reached " << acks << " < " << Q_ << "\n";
+            return false;
+        }
+
+        if (!Finalize(key, tag, false, nullptr)) {
+            std::cerr << "PUT " << key << " failed: no quorum in finalize\n";
+            return false;
+        }
+        if (verbose_) std::cout << " PUT " << key << " = " << value
+                  << " (tag.counter=" << tag.counter()
+                  << ", tag.client_id=" << tag.client_id() << ", k=" << k_ << ")\n";
+        return true;
+    }
+
+    // Always atomic: there is no cheaper CAS read to hand out for weaker levels
+    bool Get(const std::string& key, std::string& value_out,
+             Consistency = Consistency::LINEARIZABLE)
+    {
+        abd::Tag tag;
+        if (!QueryTag(key, tag)) {
+            std::cerr << "GET " << key << " failed: no quorum in CAS query\n";
+            return false;
+        }
+        if (tag.counter() == 0) {
+            // never written (finalized) anywhere in the quorum
+            value_out.clear();
+            return true;
+        }
+        if (!Finalize(key, tag, true, &value_out)) {
+            std::cerr << "GET " << key << " failed: could not collect " << k_ << " fragments of tag "
+                      << tag.counter() << "\n";
+            return false;
+        }
+        if (verbose_) std::cout << " GET " << key << " -> " << value_out
+                  << " (tag.counter=" << tag.counter()
+                  << ", tag.client_id=" << tag.client_id() << ", k=" << k_ << ")\n";
+        return true;
+    }
+
+private:
+    struct Replica {
+        std::string address;
+        std::unique_ptr<abd::ABDService::Stub> stub;
+    };
+
+    static bool TagGreater(const abd::Tag& a, const abd::Tag& b)
+    {
+        if (a.counter() != b.counter()) return a.counter() > b.counter();
+        return a.client_id() > b.client_id();
+    }
+
+    void Init()
+    {
+        N_ = static_cast<int>(replicas_.size());
+        query_.reset(new CasQueryCall(N_));
+        pre_write_.reset(new CasPreWriteCall(N_));
+        finalize_.reset(new CasFinalizeCall(N_));
+        SetDataFragments(DefaultDataFragments(N_));
+    }
+
+    bool QueryTag(const std::string& key, abd::Tag& max_tag)
+    {
+        int replies = 0;
+        max_tag.set_counter(0);
+        max_tag.set_client_id("");
+        query_->Begin();
+        query_->request().set_key(key);
+        for (int i = 0; i < N_; ++i) {
+            query_->Add(i, replicas_[i].stub.get());
+        }
+        query_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::CasQueryReply& reply) {
+                if (!ok || !status.ok()) {
+                    std::cerr << "CasQuery to " << replicas_[idx].address << " failed for " << key << ": "
+                              << (status.ok() ? "stream not ok" : status.error_message()) << "\n";
+                    return;
+                }
+                replies++;
+                if (TagGreater(reply.tag(), max_tag)) max_tag = reply.tag();
+            },
+            [&] { return replies >= Q_; });
+        return replies >= Q_;
+    }
+
+    // Finalize round. Readers (value_out set) also need k fragments among the replies.
+    bool Finalize(const std::string& key, const abd::Tag& tag, bool read, std::string* value_out)
+    {
+        int replies = 0;
+        std::vector<int> index;
+        std::vector<const std::string*> frags;
+        uint32_t value_size = 0;
+
+        finalize_->Begin();
+        abd::CasFinalizeRequest& req = finalize_->request();
+        req.set_key(key);
+        *req.mutable_tag() = tag;
+        req.set_want_fragment(read);
+        for (int i = 0; i < N_; ++i) {
+            finalize_->Add(i, replicas_[i].stub.get());
+        }
+        // replies stay in their slots until the next Begin, so keep pointers
+        finalize_->Wait(
+            [&](int idx, bool ok, const grpc::Status& status, const abd::CasFinalizeReply& reply) {
+                if (!ok || !status.ok() || !reply.ok()) {
+                    std::cerr << "CasFinalize to " << replicas_[idx].address << " failed for " << key << ": "
+                              << (status.ok() ? "NOK reply or stream not ok" : status.error_message()) << "\n";
+                    return;
+                }
+                replies++;
+                if (read && reply.has_fragment() && static_cast<int>(frags.size()) < k_) {
+                    index.push_back(idx);
+                    frags.push_back(&reply.fragment());
+                    value_size = reply.value_size();
+                }
+            },
+            [&] { return replies >= Q_ && (!read || static_cast<int>(frags.size()) >= k_); });
+
+        if (replies < Q_) return false;
+        if (!read) return true;
+        if (static_cast<int>(frags.size()) < k_) return false;
+        return code_->Decode(index, frags, value_size, *value_out);
+    }
+
+    std::vector<Replica> replicas_;
+    int N_ = 0;
+    int k_ = 1;
+    int Q_ = 1;
+    std::unique_ptr<ReedSolomon> code_;
+    std::vector<std::string> fragments_; // reused across PUTs
+    std::string client_id_;
+    bool verbose_ = true;
+    long value_bytes_ = 0;
+    long fragment_bytes_ = 0;
+
+    std::unique_ptr<CasQueryCall> query_;
+    std::unique_ptr<CasPreWriteCall> pre_write_;
+    std::unique_ptr<CasFinalizeCall> finalize_;
+};
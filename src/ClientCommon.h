@@ -0,0 +1,210 @@
+#pragma once
+
+#include "src/Consistency.h"
+#include <grpcpp/grpcpp.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Shared bits for the client binaries: config/workload parsing and channel setup.
+
+inline std::string Trim(const std::string& s)
+{
+    std::string result = s;
+    auto start = result.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) return "";
+    auto end = result.find_last_not_of(" \t\r\n");
+    return result.substr(start, end - start + 1);
+}
+
+// Read/write quorum sizes, 0 = majority of however many replicas there are
+struct QuorumConfig {
+    int R = 0;
+    int W = 0;
+};
+
+// One replica set; keys are spread over groups by HashRing (see ShardedClient.h). The ring
+// only looks at the name, so a later generation of a group (new membership, same name)
+// owns exactly the keys the earlier one did.
+struct ServerGroup {
+    std::string name;
+    std::vector<std::string> addrs;
+    int generation = 1;
+};
+
+// One address per line, '#' comments out a replica (we love commenting for 1,3,5 quorums).
+// "[name]" starts a new replica group; addresses before the first one form a group
+// called "default", so an old single-group file still works. "R = n" / "W = n" lines set
+// the quorum sizes for every group; flags on the command line win over them.
+// "generation = n" under a group numbers its membership (see load_driver --migrate-to);
+// ABD clients send it along so retired replicas can refuse outdated files.
+inline bool LoadServerGroups(const std::string& path, std::vector<ServerGroup>& groups,
+                             QuorumConfig* quorums = nullptr)
+{
+    std::ifstream cfg(path);
+    if (!cfg.is_open()) {
+        std::cerr << "Failed to open " << path << "\n";
+        return false;
+    }
+
+    std::string line_cfg;
+    while (std::getline(cfg, line_cfg)) {
+        std::string trimmed = Trim(line_cfg);
+        if (trimmed.empty()) continue;
+        if (trimmed[0] == '#') continue;
+
+        if (trimmed.front() == '[' && trimmed.back() == ']') {
+            std::string name = Trim(trimmed.substr(1, trimmed.size() - 2));
+            for (const auto& g : groups) {
+                if (g.name == name) {
+                    std::cerr << "Duplicate group in " << path << ": " << name << "\n";
+                    return false;
+                }
+            }
+            groups.push_back({name, {}});
+            continue;
+        }
+
+        auto eq = trimmed.find('=');
+        if (eq != std::string::npos) {
+            std::string name = Trim(trimmed.substr(0, eq));
+            int n = std::atoi(trimmed.substr(eq + 1).c_str());
+            if (name == "R" || name == "W") {
+                if (quorums) (name == "R" ? quorums->R : quorums->W) = n;
+            } else if (name == "generation") {
+                if (groups.empty()) groups.push_back({"default", {}});
+                if (n < 1) {
+                    std::cerr << "Bad generation in " << path << ": " << trimmed << "\n";
+                    return false;
+                }
+                groups.back().generation = n;
+            } else {
+                std::cerr << "Unknown setting in " << path << ": " << trimmed << "\n";
+                return false;
+            }
+            continue;
+        }
+        if (groups.empty()) groups.push_back({"default", {}});
+        groups.back().addrs.push_back(trimmed);
+    }
+
+    if (groups.empty()) {
+        std::cerr << "No server addresses found in " << path << "\n";
+        return false;
+    }
+    for (const auto& g : groups) {
+        if (g.addrs.empty()) {
+            std::cerr << "No server addresses for group " << g.name << " in " << path << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Fills in majority defaults and refuses sizes ABD (and the lock protocol) isn't safe
+// with: reads must meet every completed write (R + W > N), writes must meet each other
+// (W > N/2).
+inline bool ValidateQuorums(int N, QuorumConfig& q)
+{
+    if (q.R == 0) q.R = N / 2 + 1;
+    if (q.W == 0) q.W = N / 2 + 1;
+    if (q.R < 1 || q.R > N || q.W < 1 || q.W > N) {
+        std::cerr << "Quorum sizes out of range: N=" << N << " R=" << q.R << " W=" << q.W << "\n";
+        return false;
+    }
+    if (q.R + q.W <= N) {
+        std::cerr << "Unsafe quorums: R + W must exceed N (N=" << N << " R=" << q.R << " W=" << q.W << ")\n";
+        return false;
+    }
+    if (2 * q.W <= N) {
+        std::cerr << "Unsafe quorums: W must exceed N/2 (N=" << N << " W=" << q.W << ")\n";
+        return false;
+    }
+    return true;
+}
+
+// One channel per replica, meant to be shared by every logical client in the process
+inline std::vector<std::shared_ptr<grpc::Channel>> CreateChannels(const std::vector<std::string>& server_addrs)
+{
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    channels.reserve(server_addrs.size());
+    for (const auto& addr : server_addrs) {
+        channels.push_back(grpc::CreateChannel(addr, grpc::InsecureChannelCredentials()));
+    }
+    return channels;
+}
+
+// Same, per replica group
+inline std::vector<std::vector<std::shared_ptr<grpc::Channel>>> CreateGroupChannels(const std::vector<ServerGroup>& groups)
+{
+    std::vector<std::vector<std::shared_ptr<grpc::Channel>>> channels;
+    channels.reserve(groups.size());
+    for (const auto& g : groups) {
+        channels.push_back(CreateChannels(g.addrs));
+    }
+    return channels;
+}
+
+struct WorkloadOp {
+    enum Type { PUT, GET };
+    Type type;
+    std::string key;
+    std::string value; // PUT only
+    Consistency consistency = Consistency::LINEARIZABLE; // GET only
+};
+
+// Same format the client mains replay: "PUT key value" / "GET key [level]", '#' for
+// comments. GETs without a level get default_level. MPUT lines fail the load.
+inline bool LoadWorkload(const std::string& path, std::vector<WorkloadOp>& ops,
+                         Consistency default_level = Consistency::LINEARIZABLE)
+{
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        std::cerr << "Failed to open input file: " << path << "\n";
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string trimmed = Trim(line);
+        if (trimmed.empty()) continue;
+        if (trimmed[0] == '#') continue;
+
+        std::istringstream iss(trimmed);
+        std::string cmd;
+        iss >> cmd;
+        if (cmd == "PUT" || cmd == "put") {
+            WorkloadOp op;
+            op.type = WorkloadOp::PUT;
+            iss >> op.key;
+            std::getline(iss, op.value);
+            op.value = Trim(op.value);
+            ops.push_back(std::move(op));
+        } else if (cmd == "GET" || cmd == "get") {
+            WorkloadOp op;
+            op.type = WorkloadOp::GET;
+            iss >> op.key;
+            std::string level;
+            op.consistency = default_level;
+            if (iss >> level && !ParseConsistency(level, op.consistency)) {
+                std::cerr << "Unknown consistency level in input file: " << level << "\n";
+                return false;
+            }
+            ops.push_back(std::move(op));
+        } else if (cmd == "MPUT" || cmd == "mput") {
+            // a multi-key op has no place in per-key chains, and only the blocking client
+            // has MultiPut; dropping it would quietly replay a different workload
+            std::cerr << "MPUT in input file " << path << " is only supported by blocking_client's "
+                      << "sequential replay (no --max-in-flight); refusing: " << trimmed << "\n";
+            return false;
+        } else {
+            std::cerr << "Unknown command in input file: " << cmd << "\n";
+        }
+    }
+    return true;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cctype>
+#include <string>
+
+// Per-GET consistency level; PUTs are always the full protocol.
+//   LINEARIZABLE  the usual two phases (query R, write back to W)
+//   REGULAR       query R, skip the write-back: never older than the last write that
+//                 completed before the GET started, but two GETs overlapping a write can
+//                 see new-then-old
+//   ONE           whichever replica answers first, can be arbitrarily stale
+enum class Consistency { LINEARIZABLE, REGULAR, ONE };
+
+inline const char* ConsistencyName(Consistency c)
+{
+    switch (c) {
+    case Consistency::REGULAR: return "regular";
+    case Consistency::ONE: return "one";
+    default: return "linearizable";
+    }
+}
+
+// Accepts the names above in any case
+inline bool ParseConsistency(std::string s, Consistency& out)
+{
+    for (auto& ch : s) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    if (s == "linearizable") {
+        out = Consistency::LINEARIZABLE;
+    } else if (s == "regular") {
+        out = Consistency::REGULAR;
+    } else if (s == "one") {
+        out = Consistency::ONE;
+    } else {
+        return false;
+    }
+    return true;
+}
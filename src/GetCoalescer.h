@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// Singleflight for GETs issued by the logical clients of one process. The first GET on a
+// key opens a flight and holds it open for a short join window; any GET on that key that
+// shows up meanwhile parks on the flight instead of running its own quorum. Once the
+// window closes the flight is sealed (taken out of the table) and only then does the
+// leader start phase 1, so later arrivals open a new flight.
+//
+// That ordering is what keeps it linearizable: every follower was invoked before the
+// leader's ReadQuery went out, and the leader's read takes effect somewhere after that
+// and before it returns, i.e. inside every follower's own interval. Joining a flight that
+// is already past phase 1 could hand back a value older than a write that completed
+// before the follower started, which is why there's no "join whatever is running".
+class GetCoalescer {
+public:
+    using Fetch = std::function<bool(std::string& value_out)>;
+
+    explicit GetCoalescer(std::chrono::microseconds window) : window_(window) {}
+
+    // Either leads a flight (runs fetch) or waits for the one already open on key
+    bool Get(const std::string& key, std::string& value_out, const Fetch& fetch)
+    {
+        std::unique_lock<std::mutex> lock(mu_);
+        auto it = open_.find(key);
+        if (it != open_.end()) {
+            std::shared_ptr<Flight> flight = it->second;
+            joined_.fetch_add(1);
+            flight->cv.wait(lock, [&] { return flight->done; });
+            value_out = flight->value;
+            return flight->ok;
+        }
+
+        auto flight = std::make_shared<Flight>();
+        open_.emplace(key, flight);
+        led_.fetch_add(1);
+        lock.unlock();
+
+        if (window_.count() > 0) std::this_thread::sleep_for(window_);
+
+        lock.lock();
+        open_.erase(key); // sealed, nobody joins past this point
+        lock.unlock();
+
+        // only the leader touches flight->value until done is set
+        bool ok = fetch(flight->value);
+
+        lock.lock();
+        flight->ok = ok;
+        flight->done = true;
+        value_out = flight->value;
+        lock.unlock();
+        flight->cv.notify_all();
+        return ok;
+    }
+
+    std::chrono::microseconds Window() const { return window_; }
+    long Led() const { return led_.load(); }
+    long Joined() const { return joined_.load(); }
+
+private:
+    struct Flight {
+        std::condition_variable cv;
+        bool done = false;
+        bool ok = false;
+        std::string value;
+    };
+
+    const std::chrono::microseconds window_;
+    std::mutex mu_;
+    std::unordered_map<std::string, std::shared_ptr<Flight>> open_;
+    std::atomic<long> led_{0};
+    std::atomic<long> joined_{0};
+};
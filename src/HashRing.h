@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Consistent-hash ring over replica groups. Every group gets `vnodes` points on a 64-bit
+// ring, placed by hashing its *name*, so all clients reading the same servers.conf agree
+// on the layout and adding a group only moves the keys that land on its new points.
+class HashRing {
+public:
+    explicit HashRing(const std::vector<std::string>& group_names, int vnodes = 64)
+    {
+        points_.reserve(group_names.size() * vnodes);
+        for (size_t g = 0; g < group_names.size(); ++g) {
+            for (int v = 0; v < vnodes; ++v) {
+                points_.emplace_back(Hash(group_names[g] + "#" + std::to_string(v)), static_cast<int>(g));
+            }
+        }
+        std::sort(points_.begin(), points_.end());
+    }
+
+    // Index of the group owning key: first point clockwise from the key's hash
+    int GroupFor(const std::string& key) const
+    {
+        if (points_.size() <= 1) return points_.empty() ? 0 : points_[0].second;
+        auto it = std::lower_bound(points_.begin(), points_.end(), std::make_pair(Hash(key), -1));
+        if (it == points_.end()) it = points_.begin();
+        return it->second;
+    }
+
+private:
+    // FNV-1a, then a splitmix64 finalizer since FNV alone clusters on short similar keys
+    static uint64_t Hash(const std::string& s)
+    {
+        uint64_t h = 14695981039346656037ull;
+        for (unsigned char c : s) {
+            h ^= c;
+            h *= 1099511628211ull;
+        }
+        h ^= h >> 30;
+        h *= 0xbf58476d1ce4e5b9ull;
+        h ^= h >> 27;
+        h *= 0x94d049bb133111ebull;
+        h ^= h >> 31;
+        return h;
+    }
+
+    std::vector<std::pair<uint64_t, int>> points_;
+};
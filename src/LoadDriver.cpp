@@ -0,0 +1,590 @@
+#include "src/ABDClient_async.h"
+#include "src/BlockingClient_async.h"
+#include "src/CASClient_async.h"
+#include "src/ClientCommon.h"
+#include "src/GetCoalescer.h"
+#include "src/Migration.h"
+#include "src/ShardedClient.h"
+#include "src/WorkStealingPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// In-process replacement for something.txt: instead of 16 blocking_client processes, run
+// K logical clients (each with its own client_id, replaying the whole input file like one
+// of those processes did) on T worker threads over one shared channel per replica, and
+// merge everything into one CSV and one summary.
+
+struct OpRecord {
+    int client;
+    const WorkloadOp* op;
+    double latency_ms;
+    bool ok;
+    bool refused; // failed only because the key was migrating (ShardedClient::MigratingRefusals)
+    int phase; // 0 before a migration, 1 during, 2 after
+};
+
+struct DriverOptions {
+    std::string protocol = "abd";
+    std::string servers_path = "servers.conf";
+    std::string input_path;
+    int clients = 16;
+    int threads = 0; // 0 -> one per client
+    int coalesce_us = -1; // <0 -> every GET runs its own quorum
+    bool optimistic_put = false; // abd only
+    bool coordinated = false;    // abd only: replicas run the phases (CoordinatedPut/Get)
+    int cas_k = 0;               // cas only: data fragments (>= 2), 0 -> N - 2 per group
+    int lock_wait_ms = 0;        // blocking only: >0 queues on held locks instead of polling
+    int lease_ms = 0;            // blocking only: lock lease to ask for, 0 -> the server's
+    int backoff_base_us = 200;   // blocking only: lock poll backoff range, --lock-backoff base:cap
+    int backoff_cap_us = 20000;
+    bool backoff_set = false;
+    int session_idle_ms = 0;     // blocking only: keep locks between same-key ops, see SetLockSessions
+    bool lock_coordinator = false; // blocking only: each key's lock on one replica, see SetLockCoordinator
+    bool fused_locks = false;    // blocking only: AcquireAndQuery / PropAndRelease
+    bool exclusive_reads = false; // blocking only: GETs lock like PUTs instead of SHARED
+    bool always_write_back = false; // blocking only: no settled-tag shortcut for GETs
+    QuorumConfig quorum_flags;   // override servers.conf
+    Consistency consistency = Consistency::LINEARIZABLE; // GETs without a level in the file
+    std::string migrate_to;      // abd or blocking: servers.conf of the ring (or generation) to move to mid-run
+    int migrate_after_ms = 1000;
+};
+
+static void Usage(const char* prog)
+{
+    std::cerr << "Usage: " << prog
+              << " [--protocol abd|blocking|cas] [--cas-k k] [--clients K] [--threads T] [--servers path]"
+              << " [--coalesce-gets window_us] [--optimistic-put] [--coordinated] [--read-quorum R] [--write-quorum W]"
+              << " [--lock-wait ms] [--lock-backoff base_us:cap_us] [--lease-ms ms] [--lock-session idle_ms] [--lock-coordinator] [--fused-locks] [--exclusive-reads] [--always-write-back]"
+              << " [--consistency linearizable|regular|one]"
+              << " [--migrate-to servers_path] [--migrate-after ms]"
+              << " <input_file>"
+              << std::endl;
+}
+
+static bool ParseArgs(int argc, char** argv, DriverOptions& opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        if (arg == "--protocol") {
+            const char* v = next();
+            if (!v) return false;
+            opts.protocol = v;
+        } else if (arg == "--clients") {
+            const char* v = next();
+            if (!v) return false;
+            opts.clients = std::atoi(v);
+        } else if (arg == "--threads") {
+            const char* v = next();
+            if (!v) return false;
+            opts.threads = std::atoi(v);
+        } else if (arg == "--servers") {
+            const char* v = next();
+            if (!v) return false;
+            opts.servers_path = v;
+        } else if (arg == "--coalesce-gets") {
+            const char* v = next();
+            if (!v) return false;
+            opts.coalesce_us = std::atoi(v);
+            if (opts.coalesce_us < 0) return false;
+        } else if (arg == "--optimistic-put") {
+            opts.optimistic_put = true;
+        } else if (arg == "--coordinated") {
+            opts.coordinated = true;
+        } else if (arg == "--cas-k") {
+            const char* v = next();
+            if (!v) return false;
+            opts.cas_k = std::atoi(v);
+            if (opts.cas_k < 1) return false;
+        } else if (arg == "--lock-wait") {
+            const char* v = next();
+            if (!v) return false;
+            opts.lock_wait_ms = std::atoi(v);
+            if (opts.lock_wait_ms < 0) return false;
+        } else if (arg == "--lock-backoff") {
+            const char* v = next();
+            if (!v || !ParseBackoff(v, opts.backoff_base_us, opts.backoff_cap_us)) return false;
+            opts.backoff_set = true;
+        } else if (arg == "--lock-session") {
+            const char* v = next();
+            if (!v) return false;
+            opts.session_idle_ms = std::atoi(v);
+            if (opts.session_idle_ms < 1) return false;
+        } else if (arg == "--lock-coordinator") {
+            opts.lock_coordinator = true;
+        } else if (arg == "--fused-locks") {
+            opts.fused_locks = true;
+        } else if (arg == "--exclusive-reads") {
+            opts.exclusive_reads = true;
+        } else if (arg == "--always-write-back") {
+            opts.always_write_back = true;
+        } else if (arg == "--lease-ms") {
+            const char* v = next();
+            if (!v) return false;
+            opts.lease_ms = std::atoi(v);
+            if (opts.lease_ms < 0) return false;
+        } else if (arg == "--consistency") {
+            const char* v = next();
+            if (!v || !ParseConsistency(v, opts.consistency)) return false;
+        } else if (arg == "--read-quorum") {
+            const char* v = next();
+            if (!v) return false;
+            opts.quorum_flags.R = std::atoi(v);
+        } else if (arg == "--write-quorum") {
+            const char* v = next();
+            if (!v) return false;
+            opts.quorum_flags.W = std::atoi(v);
+        } else if (arg == "--migrate-to") {
+            const char* v = next();
+            if (!v) return false;
+            opts.migrate_to = v;
+        } else if (arg == "--migrate-after") {
+            const char* v = next();
+            if (!v) return false;
+            opts.migrate_after_ms = std::atoi(v);
+            if (opts.migrate_after_ms < 0) return false;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Unknown flag: " << arg << "\n";
+            return false;
+        } else {
+            opts.input_path = arg;
+        }
+    }
+    if (opts.input_path.empty() || opts.clients < 1) return false;
+    if (opts.protocol != "abd" && opts.protocol != "blocking" && opts.protocol != "cas") return false;
+    if (opts.threads <= 0) opts.threads = opts.clients;
+    if (opts.coordinated && opts.protocol != "abd") {
+        std::cerr << "--coordinated needs --protocol abd\n";
+        return false;
+    }
+    if ((opts.lock_wait_ms || opts.backoff_set || opts.lease_ms || opts.session_idle_ms || opts.fused_locks ||
+         opts.lock_coordinator || opts.exclusive_reads || opts.always_write_back) && opts.protocol != "blocking") {
+        std::cerr << "--lock-wait / --lock-backoff / --lease-ms / --lock-session / --lock-coordinator / --fused-locks"
+                  << " / --exclusive-reads / --always-write-back"
+                  << " need --protocol blocking\n";
+        return false;
+    }
+    if (opts.session_idle_ms && opts.fused_locks) {
+        std::cerr << "--lock-session doesn't go with --fused-locks (PropAndRelease always unlocks)\n";
+        return false;
+    }
+    if (opts.lock_coordinator && opts.fused_locks) {
+        std::cerr << "--lock-coordinator doesn't go with --fused-locks (the fused query needs a quorum of locks)\n";
+        return false;
+    }
+    if (!opts.migrate_to.empty() && opts.protocol == "cas") {
+        std::cerr << "--migrate-to needs --protocol abd or blocking (the mover copies whole values, not fragments)\n";
+        return false;
+    }
+    return true;
+}
+
+static double Percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.empty()) return 0.0;
+    size_t idx = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(idx, sorted.size() - 1)];
+}
+
+static void PrintLatencyLine(const std::string& label, std::vector<double> lat)
+{
+    std::sort(lat.begin(), lat.end());
+    double sum = 0.0;
+    for (double l : lat) sum += l;
+    double mean = lat.empty() ? 0.0 : sum / lat.size();
+    std::cout << label << ": n=" << lat.size()
+              << " mean=" << mean
+              << " p50=" << Percentile(lat, 0.50)
+              << " p90=" << Percentile(lat, 0.90)
+              << " p99=" << Percentile(lat, 0.99)
+              << " max=" << (lat.empty() ? 0.0 : lat.back()) << " ms\n";
+}
+
+// `groups` is every group (generation) either ring uses; keys start on `active` and, with
+// --migrate-to, move to `next` partway through the run
+template <typename Client>
+static int RunDriver(const DriverOptions& opts,
+                     const std::vector<ServerGroup>& groups,
+                     const std::vector<int>& active,
+                     const std::vector<int>& next,
+                     const QuorumConfig& quorums,
+                     const std::vector<WorkloadOp>& workload)
+{
+    auto channels = CreateGroupChannels(groups);
+    for (const auto& g : groups) {
+        for (const auto& addr : g.addrs) {
+            std::cout << "LoadDriver connecting to " << addr << " (group " << GroupLabel(g) << ")\n";
+        }
+    }
+
+    struct LogicalClient {
+        std::unique_ptr<ShardedClient<Client>> client;
+        size_t next_op = 0;
+    };
+
+    auto routing = std::make_shared<Routing>(groups, active);
+    std::vector<LogicalClient> clients(opts.clients);
+    std::string pid = std::to_string(getpid());
+    for (int c = 0; c < opts.clients; ++c) {
+        clients[c].client.reset(
+            new ShardedClient<Client>(groups, channels, pid + "-" + std::to_string(c), routing));
+        clients[c].client->SetVerbose(false);
+        clients[c].client->SetQuorums(groups, quorums);
+        if constexpr (std::is_same_v<Client, ABDClient>) {
+            clients[c].client->SetGenerations(groups);
+            clients[c].client->SetOptimisticPuts(opts.optimistic_put);
+            clients[c].client->SetCoordinated(opts.coordinated);
+        }
+        if constexpr (std::is_same_v<Client, CASClient>) {
+            if (opts.cas_k) clients[c].client->SetDataFragments(opts.cas_k);
+        }
+        if constexpr (std::is_same_v<Client, BlockingClient>) {
+            clients[c].client->SetLockWait(opts.lock_wait_ms);
+            clients[c].client->SetLease(opts.lease_ms);
+            clients[c].client->SetFused(opts.fused_locks);
+            clients[c].client->SetSharedReads(!opts.exclusive_reads);
+            clients[c].client->SetLockBackoff(opts.backoff_base_us, opts.backoff_cap_us);
+            clients[c].client->SetLockSessions(opts.session_idle_ms);
+            clients[c].client->SetLockCoordinator(opts.lock_coordinator);
+            clients[c].client->SetSkipSettledWriteBack(!opts.always_write_back);
+        }
+    }
+
+    // opt-in: logical clients share GETs on the same key (see GetCoalescer.h). A follower
+    // parks its worker until the leader is done, so this wants threads == clients.
+    std::unique_ptr<GetCoalescer> coalescer;
+    if (opts.coalesce_us >= 0) {
+        coalescer.reset(new GetCoalescer(std::chrono::microseconds(opts.coalesce_us)));
+    }
+
+    WorkStealingPool pool(opts.threads);
+    // one result buffer per worker, merged after the run; no locking on the hot path
+    std::vector<std::vector<OpRecord>> results(pool.NumWorkers());
+    for (auto& r : results) r.reserve(workload.size() * opts.clients / pool.NumWorkers() + 16);
+
+    // A logical client is a closed loop: run one op, then queue its next op on the same
+    // worker. Idle workers steal whole continuations, so a slow RPC never strands the rest.
+    std::atomic<int> phase{0};
+    std::chrono::steady_clock::time_point phase_start[3];
+    std::function<void(int, int)> run_next = [&](int c, int worker) {
+        LogicalClient& lc = clients[c];
+        const WorkloadOp& op = workload[lc.next_op];
+
+        const int op_phase = phase.load(std::memory_order_relaxed);
+        const long refusals = lc.client->MigratingRefusals();
+        auto op_start = std::chrono::steady_clock::now();
+        bool ok;
+        if (op.type == WorkloadOp::PUT) {
+            ok = lc.client->Put(op.key, op.value);
+        } else {
+            std::string value;
+            // only linearizable GETs share flights, a weaker leader can't answer for them
+            if (coalescer && op.consistency == Consistency::LINEARIZABLE) {
+                ok = coalescer->Get(op.key, value,
+                                    [&](std::string& v) { return lc.client->Get(op.key, v, op.consistency); });
+            } else {
+                ok = lc.client->Get(op.key, value, op.consistency);
+            }
+        }
+        auto op_end = std::chrono::steady_clock::now();
+        double latency_ms = std::chrono::duration<double, std::milli>(op_end - op_start).count();
+
+        const bool refused = !ok && lc.client->MigratingRefusals() > refusals;
+        results[worker].push_back({c, &op, latency_ms, ok, refused, op_phase});
+
+        if (++lc.next_op < workload.size()) {
+            pool.Submit([&run_next, c](int w) { run_next(c, w); }, worker);
+        }
+    };
+
+    auto tt_start = std::chrono::steady_clock::now();
+    phase_start[0] = tt_start;
+    if (!workload.empty()) {
+        for (int c = 0; c < opts.clients; ++c) {
+            pool.Submit([&run_next, c](int w) { run_next(c, w); });
+        }
+    }
+
+    // the migration runs beside the load on its own thread and its own client_id
+    MigrationStats migration;
+    std::thread migrator;
+    if constexpr (!std::is_same_v<Client, CASClient>) {
+        if (!next.empty()) {
+            migrator = std::thread([&]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(opts.migrate_after_ms));
+                ShardedClient<ABDClient> mover(groups, channels, pid + "-migrator", routing);
+                mover.SetVerbose(false);
+                mover.SetQuorums(groups, quorums);
+                mover.SetGenerations(groups);
+                phase_start[1] = std::chrono::steady_clock::now();
+                phase = 1;
+                migration = Migrator(groups, channels, quorums, routing, mover).Run(next);
+                phase_start[2] = std::chrono::steady_clock::now();
+                phase = 2;
+            });
+        }
+    }
+    pool.WaitIdle();
+    auto tt_stop = std::chrono::steady_clock::now();
+    if (migrator.joinable()) migrator.join();
+
+    auto now = std::chrono::system_clock::now();
+    std::time_t t = std::chrono::system_clock::to_time_t(now);
+    std::tm tm = *std::localtime(&t);
+    char buf[64];
+    std::strftime(buf, sizeof(buf), "%d-%m-%Y_%H:%M:%S", &tm);
+    std::string csv_path = "logs/" + opts.input_path + "-driver-" + opts.protocol + "-" + buf + ".csv";
+    std::ofstream csv(csv_path);
+    if (!csv.is_open()) {
+        std::cerr << "Failed to open CSV file: " << csv_path << "\n";
+        return 1;
+    }
+    csv << "client,op,key,value,latency_ms,success,consistency\n";
+
+    int ops = 0;
+    int failures = 0;
+    int refused = 0;
+    std::vector<double> all_lat, put_lat, get_lat;
+    std::vector<double> phase_lat[3];
+    for (const auto& per_worker : results) {
+        for (const auto& rec : per_worker) {
+            const bool is_put = rec.op->type == WorkloadOp::PUT;
+            csv << rec.client << "," << (is_put ? "PUT," : "GET,") << rec.op->key << ","
+                << rec.op->value << "," << rec.latency_ms << "," << (rec.ok ? 1 : 0) << ","
+                << ConsistencyName(is_put ? Consistency::LINEARIZABLE : rec.op->consistency) << "\n";
+            ops++;
+            if (rec.refused) refused++;
+            else if (!rec.ok) failures++;
+            all_lat.push_back(rec.latency_ms);
+            (is_put ? put_lat : get_lat).push_back(rec.latency_ms);
+            phase_lat[rec.phase].push_back(rec.latency_ms);
+        }
+    }
+
+    auto total_time = std::chrono::duration_cast<std::chrono::milliseconds>(tt_stop - tt_start).count();
+    double total_time_sec = total_time / 1000.0;
+    double throughput = (total_time_sec > 0.0) ? (ops / total_time_sec) : 0.0;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "=== Performance Summary ===\n";
+    std::cout << "Protocol         : " << opts.protocol << "\n";
+    if constexpr (std::is_same_v<Client, CASClient>) {
+        // R/W don't apply; report the code and what it saved on the wire
+        long value_bytes = 0, fragment_bytes = 0;
+        for (const auto& lc : clients) {
+            for (int g = 0; g < lc.client->NumGroups(); ++g) {
+                value_bytes += lc.client->Group(g).ValueBytes();
+                fragment_bytes += lc.client->Group(g).FragmentBytes();
+            }
+        }
+        std::cout << "Erasure Code     :";
+        for (size_t g = 0; g < groups.size(); ++g) {
+            const CASClient& first = clients[0].client->Group(static_cast<int>(g));
+            std::cout << (g ? ", " : " ") << GroupLabel(groups[g]) << " N=" << groups[g].addrs.size()
+                      << " k=" << first.DataFragments() << " q=" << first.Quorum();
+        }
+        std::cout << "\n";
+        std::cout << "PUT Bytes Sent   : " << fragment_bytes << " coded for " << value_bytes << " of values ("
+                  << (value_bytes ? static_cast<double>(fragment_bytes) / value_bytes : 0.0) << "x)\n";
+    } else {
+        std::cout << "Quorums          : " << DescribeGroupQuorums(groups, quorums) << "\n";
+    }
+    std::cout << "Logical Clients  : " << opts.clients << "\n";
+    std::cout << "Worker Threads   : " << pool.NumWorkers() << " (" << pool.Steals() << " steals)\n";
+    if constexpr (std::is_same_v<Client, ABDClient>) {
+        if (opts.optimistic_put) {
+            long one_round = 0;
+            for (const auto& lc : clients) one_round += lc.client->OneRoundPuts();
+            std::cout << "One-Round PUTs   : " << one_round << " of " << put_lat.size() << "\n";
+        }
+    }
+    if (opts.coordinated) {
+        std::cout << "Coordinated      : yes (server-side phases)\n";
+    }
+    if constexpr (std::is_same_v<Client, BlockingClient>) {
+        long lock_rpcs = 0, ordered = 0, renewals = 0, lost = 0, skipped = 0;
+        long acquires = 0, retries = 0, churn = 0, session_ops = 0, fenced = 0;
+        for (const auto& lc : clients) {
+            session_ops += lc.client->SessionOps();
+            fenced += lc.client->FencedWrites();
+            lock_rpcs += lc.client->LockRpcs();
+            acquires += lc.client->LockAcquires();
+            retries += lc.client->LockRetries();
+            churn += lc.client->LockHolderChanges();
+            ordered += lc.client->OrderedAcquires();
+            skipped += lc.client->WriteBacksSkipped();
+            renewals += lc.client->LeaseRenewals();
+            lost += lc.client->LeasesLost();
+        }
+        if (opts.lock_wait_ms) {
+            std::cout << "Lock Wait        : queued server-side, up to " << opts.lock_wait_ms << " ms\n";
+        } else {
+            std::cout << "Lock Wait        : polling, backoff " << opts.backoff_base_us << "-"
+                      << opts.backoff_cap_us << " us with jitter\n";
+        }
+        if (opts.lock_coordinator) {
+            std::cout << "Lock Placement   : one coordinator replica per key, " << fenced << " writes fenced\n";
+        } else {
+            std::cout << "Lock Placement   : quorum\n";
+        }
+        if (opts.fused_locks) {
+            std::cout << "Fused Lock RPCs  : yes (AcquireAndQuery + PropAndRelease)\n";
+        }
+        if (opts.session_idle_ms) {
+            std::cout << "Lock Sessions    : " << opts.session_idle_ms << " ms idle lease, " << session_ops
+                      << " of " << ops << " ops ran without acquiring\n";
+        }
+        std::cout << "GET Locks        : " << (opts.exclusive_reads ? "exclusive" : "shared") << "\n";
+        std::cout << "GET Write-backs  : " << skipped << " of " << get_lat.size() << " skipped (tag settled)\n";
+        std::cout << "Lock RPCs        : " << lock_rpcs << " ("
+                  << (ops ? static_cast<double>(lock_rpcs) / ops : 0.0) << " per op), "
+                  << ordered << " acquires finished in replica order\n";
+        std::cout << "Lock Retries     : " << retries << " ("
+                  << (acquires ? static_cast<double>(retries) / acquires : 0.0) << " per acquire, "
+                  << churn << " holder changes seen)\n";
+        std::cout << "Lock Leases      : "
+                  << (opts.lease_ms ? std::to_string(opts.lease_ms) + " ms" : std::string("server default"))
+                  << ", " << renewals << " renewed, " << lost << " lost before release\n";
+    }
+    if (coalescer) {
+        std::cout << "GET Coalescing   : " << coalescer->Window().count() << " us window, "
+                  << coalescer->Led() << " quorum reads, " << coalescer->Joined() << " joined\n";
+    }
+    std::cout << "Total Operations : " << ops << " (" << failures << " failed";
+    if (!next.empty()) std::cout << ", " << refused << " refused: key migrating";
+    std::cout << ")\n";
+    std::cout << "Total Time       : " << total_time << " ms ("
+              << total_time_sec << " s)\n";
+    std::cout << "Throughput       : " << throughput << " ops/sec\n";
+    PrintLatencyLine("Latency (all)    ", all_lat);
+    PrintLatencyLine("Latency (PUT)    ", put_lat);
+    PrintLatencyLine("Latency (GET)    ", get_lat);
+    if (!next.empty()) {
+        double moved_per_sec = migration.copy_ms > 0.0 ? migration.keys_moved * 1000.0 / migration.copy_ms : 0.0;
+        std::cout << "Migration        : " << migration.keys_moved << " keys moved of "
+                  << migration.keys_scanned << " scanned, drain " << migration.drain_ms
+                  << " ms, copy " << migration.copy_ms << " ms (" << moved_per_sec
+                  << " keys/s), total " << migration.total_ms << " ms"
+                  << (phase == 2 && migration.copy_failures == 0 ? "" : ", NOT flipped") << "\n";
+        std::cout << "Retired Replicas : " << migration.replicas_retired;
+        if (migration.retire_failures) std::cout << " (" << migration.retire_failures << " unreachable)";
+        std::cout << "\n";
+        // a phase's throughput counts ops that started in it; "after" may be empty if the
+        // run ended first
+        const char* labels[3] = {"(before)", "(during)", "(after) "};
+        for (int p = 0; p < 3; ++p) {
+            double secs = 0.0;
+            if (phase >= p) {
+                auto end = (p < 2 && phase > p) ? std::min(phase_start[p + 1], tt_stop) : tt_stop;
+                secs = std::chrono::duration<double>(end - phase_start[p]).count();
+            }
+            std::cout << "Throughput " << labels[p] << ": "
+                      << (secs > 0.0 ? phase_lat[p].size() / secs : 0.0) << " ops/sec\n";
+            PrintLatencyLine(std::string("Latency ") + labels[p] + " ", phase_lat[p]);
+        }
+    }
+    std::cout << "CSV              : " << csv_path << "\n";
+
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    DriverOptions opts;
+    if (!ParseArgs(argc, argv, opts)) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<WorkloadOp> workload;
+    if (!LoadWorkload(opts.input_path, workload, opts.consistency)) {
+        return 1;
+    }
+
+    std::vector<ServerGroup> groups;
+    QuorumConfig quorums;
+    if (!LoadServerGroups(opts.servers_path, groups, &quorums)) {
+        return 1;
+    }
+    if (opts.quorum_flags.R) quorums.R = opts.quorum_flags.R;
+    if (opts.quorum_flags.W) quorums.W = opts.quorum_flags.W;
+    std::vector<int> active, next;
+    for (size_t g = 0; g < groups.size(); ++g) active.push_back(static_cast<int>(g));
+
+    // The destination file may keep a group as is (same name and servers), add new groups,
+    // or give a group new servers under a higher "generation": that one is reconfigured,
+    // old and new replica sets both live in `groups` until the flip.
+    if (!opts.migrate_to.empty()) {
+        std::vector<ServerGroup> next_groups;
+        if (!LoadServerGroups(opts.migrate_to, next_groups)) {
+            return 1;
+        }
+        const size_t num_active = groups.size();
+        bool grows = false;
+        std::vector<std::string> kept;
+        for (const auto& ng : next_groups) {
+            auto it = std::find_if(groups.begin(), groups.begin() + num_active,
+                                   [&](const ServerGroup& g) { return g.name == ng.name; });
+            if (it == groups.begin() + num_active) {
+                next.push_back(static_cast<int>(groups.size()));
+                groups.push_back(ng);
+                grows = true;
+            } else if (it->addrs == ng.addrs && it->generation == ng.generation) {
+                next.push_back(static_cast<int>(it - groups.begin()));
+                kept.push_back(GroupLabel(ng));
+            } else if (ng.generation > it->generation) {
+                next.push_back(static_cast<int>(groups.size()));
+                groups.push_back(ng);
+            } else {
+                std::cerr << "Group " << ng.name << " changes servers in " << opts.migrate_to
+                          << " without a generation above " << it->generation << "\n";
+                return 1;
+            }
+        }
+        // New groups take keys from the old ones. A group kept under the same generation
+        // can't be retired, so clients elsewhere on the old file would go on writing the
+        // keys it lost to it (see Migration.h).
+        if (grows && !kept.empty()) {
+            std::cerr << "Group " << kept.front() << " keeps its generation in " << opts.migrate_to
+                      << ", but the ring gains groups and some of its keys move away; give it a"
+                      << " higher generation (same servers is fine) so stale clients are refused\n";
+            return 1;
+        }
+    }
+    if (!ValidateGroupQuorums(groups, quorums)) {
+        return 1;
+    }
+
+    if (opts.protocol == "blocking") {
+        return RunDriver<BlockingClient>(opts, groups, active, next, quorums, workload);
+    }
+    if (opts.protocol == "cas") {
+        for (const auto& g : groups) {
+            const int n = static_cast<int>(g.addrs.size());
+            if (opts.cas_k > n) {
+                std::cerr << "--cas-k " << opts.cas_k << " is more than group " << GroupLabel(g)
+                          << " has replicas\n";
+                return 1;
+            }
+            // k = 1 stores the whole value on every replica: replication with CAS's extra
+            // round, not a coding result
+            const int k = opts.cas_k ? opts.cas_k : CASClient::DefaultDataFragments(n);
+            if (k < 2) {
+                std::cerr << "cas: k = 1 for group " << GroupLabel(g) << " (N = " << n
+                          << ") is plain replication. Coding with one failure tolerated needs"
+                          << " N >= 4 (k = N - 2); --cas-k 2 codes N = 3 with no failure tolerated\n";
+                return 1;
+            }
+        }
+        return RunDriver<CASClient>(opts, groups, active, next, quorums, workload);
+    }
+    return RunDriver<ABDClient>(opts, groups, active, next, quorums, workload);
+}
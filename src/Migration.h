@@ -0,0 +1,199 @@
+#pragma once
+
+#include "proto/abd.grpc.pb.h"
+#include "proto/abd.pb.h"
+#include "src/ABDClient_async.h"
+#include "src/ClientCommon.h"
+#include "src/ShardedClient.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Live rebalancing from one ring to another (ABD tags; the lock protocol writes the same
+// tags, so a blocking load can run beside it). Also how a group changes membership
+// (grow 3 -> 5, replace a bad host): the next ring has a new generation of the group under
+// the same name, so every one of its keys "moves" from the old replica set to the new one.
+//   1. Routing::BeginMigration: clients start dual-routing moving keys (read both groups,
+//      max tag wins, write to the destination) and we wait out ops still on the old ring.
+//      Clients that can't dual-route (BlockingClient) refuse moving keys until the flip.
+//   2. Copy: scan a read quorum of every source group, keep the max (tag, value) of each
+//      key that changes groups, WriteProp it to the destination with its original tag.
+//      Replicas only take it if it's newer, so a client's dual-routed write always wins.
+//   3. Routing::Flip: only the new ring is left.
+//   4. Retire: every group that left the ring (a removed group, or the old generation of
+//      a reconfigured one) is told to refuse requests below its successor's generation.
+// The source keeps its (now unreachable) copies; there is no delete RPC to drop them.
+// In-process clients sharing the Routing see the switch directly. Clients elsewhere still
+// on the old servers.conf send their old generation and get refused by retired replicas,
+// so they fail until they load the new file. That only covers keys whose old group left
+// the ring, which is why a group that stays must come with a higher generation when the
+// ring gains groups (its keys leave it; load_driver checks this).
+
+struct MigrationStats {
+    long keys_scanned = 0;
+    long keys_moved = 0;
+    long copy_failures = 0;
+    long replicas_retired = 0;
+    long retire_failures = 0;
+    double drain_ms = 0.0;
+    double copy_ms = 0.0;
+    double total_ms = 0.0;
+};
+
+class Migrator {
+public:
+    // `mover` is a logical client of its own (own client_id) over the same groups
+    Migrator(const std::vector<ServerGroup>& groups,
+             const std::vector<std::vector<std::shared_ptr<grpc::Channel>>>& channels,
+             const QuorumConfig& quorums,
+             std::shared_ptr<Routing> routing,
+             ShardedClient<ABDClient>& mover)
+        : groups_(groups), quorums_(quorums), routing_(std::move(routing)), mover_(mover)
+    {
+        for (const auto& per_group : channels) {
+            std::vector<std::unique_ptr<abd::ABDService::Stub>> stubs;
+            for (const auto& ch : per_group) stubs.push_back(abd::ABDService::NewStub(ch));
+            stubs_.push_back(std::move(stubs));
+        }
+    }
+
+    MigrationStats Run(const std::vector<int>& next_groups, int page_size = 256)
+    {
+        MigrationStats stats;
+        auto t0 = std::chrono::steady_clock::now();
+
+        routing_->BeginMigration(next_groups);
+        auto t1 = std::chrono::steady_clock::now();
+
+        auto table = routing_->Snapshot();
+        for (int g : table->current_ids) {
+            std::map<std::string, abd::ScanEntry> moving;
+            if (!ScanGroup(g, *table, page_size, moving, stats)) {
+                // without a read quorum we can't know we saw every key; keep dual-routing
+                // forever rather than flip and lose some
+                std::cerr << "Migration: could not scan a read quorum of group "
+                          << GroupLabel(groups_[g]) << ", not flipping\n";
+                stats.total_ms = Ms(t0, std::chrono::steady_clock::now());
+                return stats;
+            }
+            for (const auto& kv : moving) {
+                int to = table->To(kv.first);
+                if (mover_.Group(to).Propagate(kv.first, kv.second.tag(), kv.second.value())) {
+                    stats.keys_moved++;
+                } else {
+                    stats.copy_failures++;
+                }
+            }
+        }
+        auto t2 = std::chrono::steady_clock::now();
+
+        const std::vector<int> old_ids = table->current_ids;
+        table.reset(); // Flip waits for every holder of the migrating table, us included
+        if (stats.copy_failures == 0) {
+            routing_->Flip();
+            RetireOld(old_ids, next_groups, stats);
+        } else {
+            std::cerr << "Migration: " << stats.copy_failures << " keys failed to copy, not flipping\n";
+        }
+        auto t3 = std::chrono::steady_clock::now();
+
+        stats.drain_ms = Ms(t0, t1);
+        stats.copy_ms = Ms(t1, t2);
+        stats.total_ms = Ms(t0, t3);
+        return stats;
+    }
+
+private:
+    static double Ms(std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b)
+    {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    }
+
+    static bool TagGreater(const abd::Tag& a, const abd::Tag& b)
+    {
+        if (a.counter() != b.counter()) return a.counter() > b.counter();
+        return a.client_id() > b.client_id();
+    }
+
+    // Groups on the old ring but not the new one stop serving their generation: from the
+    // next generation of the same name if there is one, else from the one after theirs.
+    // Best effort; a replica we can't reach keeps serving stale clients, so we say so.
+    void RetireOld(const std::vector<int>& old_ids, const std::vector<int>& next_ids, MigrationStats& stats)
+    {
+        for (int g : old_ids) {
+            if (std::find(next_ids.begin(), next_ids.end(), g) != next_ids.end()) continue;
+            int successor = groups_[g].generation + 1;
+            for (int n : next_ids) {
+                if (groups_[n].name == groups_[g].name) successor = groups_[n].generation;
+            }
+            for (size_t r = 0; r < stubs_[g].size(); ++r) {
+                abd::RetireRequest req;
+                req.set_generation(successor);
+                abd::Ack reply;
+                grpc::ClientContext ctx;
+                grpc::Status status = stubs_[g][r]->Retire(&ctx, req, &reply);
+                if (status.ok()) {
+                    stats.replicas_retired++;
+                } else {
+                    stats.retire_failures++;
+                    std::cerr << "Migration: could not retire " << GroupLabel(groups_[g]) << " at "
+                              << groups_[g].addrs[r] << ": " << status.error_message() << "\n";
+                }
+            }
+        }
+    }
+
+    // Every replica of the group, paged; max tag per moving key over the replicas that
+    // made it to the end. True once that's at least a read quorum.
+    bool ScanGroup(int g, const Routing::Table& table, int page_size,
+                   std::map<std::string, abd::ScanEntry>& moving, MigrationStats& stats)
+    {
+        QuorumConfig q = quorums_;
+        ValidateQuorums(static_cast<int>(groups_[g].addrs.size()), q);
+
+        int complete = 0;
+        for (size_t r = 0; r < stubs_[g].size(); ++r) {
+            std::string after;
+            bool done = false;
+            while (!done) {
+                abd::ScanRequest req;
+                req.set_after_key(after);
+                req.set_limit(page_size);
+                req.set_generation(groups_[g].generation);
+                abd::ScanReply reply;
+                grpc::ClientContext ctx;
+                grpc::Status status = stubs_[g][r]->Scan(&ctx, req, &reply);
+                if (!status.ok()) {
+                    std::cerr << "Scan of " << groups_[g].addrs[r] << " failed: "
+                              << status.error_message() << "\n";
+                    break;
+                }
+                for (const auto& e : reply.entries()) {
+                    stats.keys_scanned++;
+                    if (table.To(e.key()) == g) continue;
+                    auto it = moving.find(e.key());
+                    if (it == moving.end()) {
+                        moving.emplace(e.key(), e);
+                    } else if (TagGreater(e.tag(), it->second.tag())) {
+                        it->second = e;
+                    }
+                }
+                if (reply.entries_size() > 0) after = reply.entries(reply.entries_size() - 1).key();
+                done = reply.done();
+            }
+            if (done) complete++;
+        }
+        return complete >= q.R;
+    }
+
+    std::vector<ServerGroup> groups_;
+    QuorumConfig quorums_;
+    std::shared_ptr<Routing> routing_;
+    ShardedClient<ABDClient>& mover_;
+    std::vector<std::vector<std::unique_ptr<abd::ABDService::Stub>>> stubs_;
+};
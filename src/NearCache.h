@@ -0,0 +1,37 @@
+#pragma once
+
+#include "proto/abd.pb.h"
+
+#include <string>
+#include <unordered_map>
+
+// Per-client cache of the last (tag, value) this client saw an op complete with, per key.
+// It never answers a GET by itself: the tag rides along in ReadQuery so replicas that have
+// nothing newer can reply "not modified" and skip the value. The quorum round still
+// happens every time, so nothing about linearizability changes, only the bytes.
+//
+// Ops of one client are sequential, so the latest completed op on a key always carries a
+// tag >= anything cached for it before; updates just overwrite.
+class NearCache {
+public:
+    struct Entry {
+        abd::Tag tag;
+        std::string value;
+    };
+
+    const Entry* Find(const std::string& key) const
+    {
+        auto it = entries_.find(key);
+        return it == entries_.end() ? nullptr : &it->second;
+    }
+
+    void Update(const std::string& key, const abd::Tag& tag, const std::string& value)
+    {
+        Entry& e = entries_[key];
+        e.tag = tag;
+        e.value = value;
+    }
+
+private:
+    std::unordered_map<std::string, Entry> entries_;
+};
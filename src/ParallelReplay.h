@@ -0,0 +1,75 @@
+#pragma once
+
+#include "src/ClientCommon.h"
+#include "src/WorkStealingPool.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Dependency-aware replay of a workload file. Ops on the same key form a chain that runs
+// strictly in file order; different chains run concurrently, at most max_in_flight ops at
+// a time (one worker per in-flight slot, each with its own client object).
+//
+// Every slot needs its own client_id. A chain can hop slots between ops, and the blocking
+// client's locks, lease renewals and straggler withdrawals are all keyed by client_id, so
+// slots sharing one would re-enter or cancel each other's locks on unrelated keys.
+
+struct ReplayResult {
+    double latency_ms = 0.0;
+    bool ok = false;
+    std::string value; // value read, GET only
+};
+
+template <typename Client>
+std::vector<ReplayResult> ReplayByKey(const std::vector<WorkloadOp>& ops,
+                                      std::vector<std::unique_ptr<Client>>& clients)
+{
+    std::vector<ReplayResult> results(ops.size());
+
+    // per-key chains of op indices, in program order; chains are listed in order of
+    // their first op so the initial wave roughly follows the file
+    std::unordered_map<std::string, size_t> chain_of;
+    std::vector<std::vector<size_t>> chains;
+    for (size_t i = 0; i < ops.size(); ++i) {
+        auto it = chain_of.find(ops[i].key);
+        if (it == chain_of.end()) {
+            it = chain_of.emplace(ops[i].key, chains.size()).first;
+            chains.emplace_back();
+        }
+        chains[it->second].push_back(i);
+    }
+
+    WorkStealingPool pool(static_cast<int>(clients.size()));
+
+    // run op `pos` of a chain, then hand the next op of the same chain to this worker;
+    // it only becomes runnable once its predecessor has returned
+    std::function<void(size_t, size_t, int)> run = [&](size_t chain, size_t pos, int worker) {
+        size_t idx = chains[chain][pos];
+        const WorkloadOp& op = ops[idx];
+        ReplayResult& res = results[idx];
+        Client& client = *clients[worker];
+
+        auto op_start = std::chrono::steady_clock::now();
+        if (op.type == WorkloadOp::PUT) {
+            res.ok = client.Put(op.key, op.value);
+        } else {
+            res.ok = client.Get(op.key, res.value, op.consistency);
+        }
+        auto op_end = std::chrono::steady_clock::now();
+        res.latency_ms = std::chrono::duration<double, std::milli>(op_end - op_start).count();
+
+        if (pos + 1 < chains[chain].size()) {
+            pool.Submit([&run, chain, pos](int w) { run(chain, pos + 1, w); }, worker);
+        }
+    };
+
+    for (size_t c = 0; c < chains.size(); ++c) {
+        pool.Submit([&run, c](int w) { run(c, 0, w); });
+    }
+    pool.WaitIdle();
+
+    return results;
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include "proto/abd.grpc.pb.h"
+#include "proto/abd.pb.h"
+#include <google/protobuf/arena.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/grpcpp.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+
+// One phase of a quorum protocol: the same request fanned out to a set of replicas over a
+// single CompletionQueue, replies handed back as they land until the caller's early-exit
+// predicate is satisfied.
+//
+// The object is meant to live as long as the client and be reused for every operation:
+// the CQ, the per-replica slots and the arena-backed request/reply messages are all set
+// up once, so a steady-state round allocates nothing on our side (ClientContext and the
+// call objects themselves are gRPC's business). Not thread-safe; one per client object.
+//
+// How the RPC goes out is a compile-time binding, see TypedRpc / SerializedRpc below.
+
+template <typename Request, typename Reply>
+using PrepareAsyncFn = std::unique_ptr<grpc::ClientAsyncResponseReader<Reply>> (abd::ABDService::Stub::*)(
+    grpc::ClientContext*, const Request&, grpc::CompletionQueue*);
+
+// Through the generated stub, e.g. TypedRpc<..., &abd::ABDService::Stub::PrepareAsyncWriteQuery>.
+// gRPC serializes the request once per replica, fine for key-only requests.
+template <typename Request, typename Reply, PrepareAsyncFn<Request, Reply> Prepare>
+struct TypedRpc {
+    using Target = abd::ABDService::Stub;
+    using Wire = Reply;
+    static constexpr bool kSerializeOnce = false;
+
+    static std::unique_ptr<grpc::ClientAsyncResponseReader<Wire>> Start(
+        Target* stub, grpc::ClientContext* ctx, const Request& req, grpc::CompletionQueue* cq)
+    {
+        return (stub->*Prepare)(ctx, req, cq);
+    }
+};
+
+// Through a GenericStub with a pre-serialized payload: the request is encoded once per
+// round into a ByteBuffer and every replica gets a refcounted copy of the same slices, so
+// a PUT's value is copied/encoded once no matter how many replicas there are.
+template <const char* Method>
+struct SerializedRpc {
+    using Target = grpc::GenericStub;
+    using Wire = grpc::ByteBuffer;
+    static constexpr bool kSerializeOnce = true;
+
+    static std::unique_ptr<grpc::ClientAsyncResponseReader<Wire>> Start(
+        Target* stub, grpc::ClientContext* ctx, const grpc::ByteBuffer& payload, grpc::CompletionQueue* cq)
+    {
+        static const std::string method(Method);
+        return stub->PrepareUnaryCall(ctx, method, payload, cq);
+    }
+};
+
+template <typename Request, typename Reply, typename Rpc>
+class QuorumCall {
+public:
+    using Target = typename Rpc::Target;
+
+    explicit QuorumCall(int num_replicas)
+        : arena_(MakeArenaOptions(initial_block_, sizeof(initial_block_))),
+          slots_(new Slot[num_replicas]),
+          num_slots_(num_replicas)
+    {
+        request_ = google::protobuf::Arena::Create<Request>(&arena_);
+        for (int i = 0; i < num_slots_; ++i) {
+            slots_[i].reply = google::protobuf::Arena::Create<Reply>(&arena_);
+        }
+    }
+
+    ~QuorumCall()
+    {
+        CancelOutstanding();
+        Drain();
+        cq_.Shutdown();
+        void* tag;
+        bool ok;
+        while (cq_.Next(&tag, &ok)) {
+        }
+    }
+
+    QuorumCall(const QuorumCall&) = delete;
+    QuorumCall& operator=(const QuorumCall&) = delete;
+
+    // Shared by every replica in the round. With TypedRpc gRPC serializes it inside
+    // Add(), so it can be rewritten right after; with SerializedRpc the first Add() of
+    // the round takes the snapshot everyone gets.
+    Request& request() { return *request_; }
+
+    // Starts a new round: reaps stragglers cancelled by the previous Wait() so their slots
+    // (and replies) can be reused.
+    void Begin()
+    {
+        Drain();
+        started_ = 0;
+    }
+
+    // Fires the RPC at one replica; the replica index doubles as the slot index
+    void Add(int replica, Target* stub)
+    {
+        Slot& s = slots_[replica];
+        s.ctx.emplace();
+        if constexpr (Rpc::kSerializeOnce) {
+            if (started_ == 0) {
+                bool own_buffer;
+                payload_.Clear(); // the serializer wants an empty buffer
+                grpc::SerializationTraits<Request>::Serialize(*request_, &payload_, &own_buffer);
+            }
+            s.responder = Rpc::Start(stub, &*s.ctx, payload_, &cq_);
+            s.responder->StartCall();
+            s.wire.Clear();
+            s.responder->Finish(&s.wire, &s.status, &s);
+        } else {
+            s.responder = Rpc::Start(stub, &*s.ctx, *request_, &cq_);
+            s.responder->StartCall();
+            s.responder->Finish(s.reply, &s.status, &s);
+        }
+        s.in_flight = true;
+        ++outstanding_;
+        ++started_;
+    }
+
+    // Calls on_reply(replica, ok, status, reply) for each completion until done() returns
+    // true or every RPC of the round has come back. Whatever is still in flight at that
+    // point gets cancelled and is reaped by the next Begin(). Returns #replies seen.
+    template <typename OnReply, typename Done>
+    int Wait(OnReply&& on_reply, Done&& done)
+    {
+        int responses = 0;
+        void* got_tag;
+        bool ok = false;
+
+        while (responses < started_ && !done() && cq_.Next(&got_tag, &ok)) {
+            Slot* s = static_cast<Slot*>(got_tag);
+            Reap(*s);
+            responses++;
+            if constexpr (Rpc::kSerializeOnce) {
+                if (ok && s->status.ok()) {
+                    s->status = grpc::SerializationTraits<Reply>::Deserialize(&s->wire, s->reply);
+                }
+            }
+            on_reply(static_cast<int>(s - slots_.get()), ok, s->status, *s->reply);
+        }
+
+        CancelOutstanding();
+        return responses;
+    }
+
+    // What that replica said last; stays put until it is Add()ed to again
+    const Reply& reply(int replica) const { return *slots_[replica].reply; }
+
+    // Predicate for rounds that must hear back from everyone (e.g. lock grants, which
+    // would leak if we stopped listening)
+    static bool Never() { return false; }
+
+private:
+    struct Slot {
+        std::optional<grpc::ClientContext> ctx;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<typename Rpc::Wire>> responder;
+        grpc::Status status;
+        Reply* reply = nullptr; // arena-owned
+        grpc::ByteBuffer wire;  // SerializedRpc only
+        bool in_flight = false;
+    };
+
+    static google::protobuf::ArenaOptions MakeArenaOptions(char* block, size_t size)
+    {
+        google::protobuf::ArenaOptions opts;
+        opts.initial_block = block;
+        opts.initial_block_size = size;
+        return opts;
+    }
+
+    void Reap(Slot& s)
+    {
+        s.in_flight = false;
+        s.responder.reset();
+        --outstanding_;
+    }
+
+    void CancelOutstanding()
+    {
+        for (int i = 0; i < num_slots_; ++i) {
+            if (slots_[i].in_flight) slots_[i].ctx->TryCancel();
+        }
+    }
+
+    void Drain()
+    {
+        void* got_tag;
+        bool ok = false;
+        while (outstanding_ > 0 && cq_.Next(&got_tag, &ok)) {
+            Reap(*static_cast<Slot*>(got_tag));
+        }
+    }
+
+    alignas(8) char initial_block_[4096];
+    google::protobuf::Arena arena_;
+    grpc::CompletionQueue cq_;
+    std::unique_ptr<Slot[]> slots_;
+    int num_slots_ = 0;
+    Request* request_ = nullptr;
+    grpc::ByteBuffer payload_; // SerializedRpc only
+
+    int started_ = 0;
+    int outstanding_ = 0;
+};
+
+inline constexpr char kWritePropMethod[] = "/abd.ABDService/WriteProp";
+inline constexpr char kPropAndReleaseMethod[] = "/abd.ABDService/PropAndRelease";
+
+using WriteQueryCall = QuorumCall<abd::WriteQueryRequest, abd::WriteQueryReply,
+                                  TypedRpc<abd::WriteQueryRequest, abd::WriteQueryReply,
+                                           &abd::ABDService::Stub::PrepareAsyncWriteQuery>>;
+using ReadQueryCall = QuorumCall<abd::ReadQueryRequest, abd::ReadQueryReply,
+                                 TypedRpc<abd::ReadQueryRequest, abd::ReadQueryReply,
+                                          &abd::ABDService::Stub::PrepareAsyncReadQuery>>;
+// carries the value, so it goes out pre-serialized through the replica's GenericStub
+using WritePropCall = QuorumCall<abd::WritePropRequest, abd::Ack, SerializedRpc<kWritePropMethod>>;
+using AcquireLockCall = QuorumCall<abd::AcquireLockRequest, abd::AcquireLockReply,
+                                   TypedRpc<abd::AcquireLockRequest, abd::AcquireLockReply,
+                                            &abd::ABDService::Stub::PrepareAsyncAcquireLock>>;
+using ReleaseLockCall = QuorumCall<abd::ReleaseLockRequest, abd::ReleaseLockReply,
+                                   TypedRpc<abd::ReleaseLockRequest, abd::ReleaseLockReply,
+                                            &abd::ABDService::Stub::PrepareAsyncReleaseLock>>;
+using AcquireAndQueryCall = QuorumCall<abd::AcquireAndQueryRequest, abd::AcquireAndQueryReply,
+                                       TypedRpc<abd::AcquireAndQueryRequest, abd::AcquireAndQueryReply,
+                                                &abd::ABDService::Stub::PrepareAsyncAcquireAndQuery>>;
+// carries the value, so like WriteProp it's encoded once for every replica
+using PropAndReleaseCall = QuorumCall<abd::PropAndReleaseRequest, abd::PropAndReleaseReply,
+                                      SerializedRpc<kPropAndReleaseMethod>>;
+using AcquireLocksCall = QuorumCall<abd::AcquireLocksRequest, abd::AcquireLocksReply,
+                                    TypedRpc<abd::AcquireLocksRequest, abd::AcquireLocksReply,
+                                             &abd::ABDService::Stub::PrepareAsyncAcquireLocks>>;
+using ReleaseLocksCall = QuorumCall<abd::ReleaseLocksRequest, abd::ReleaseLockReply,
+                                    TypedRpc<abd::ReleaseLocksRequest, abd::ReleaseLockReply,
+                                             &abd::ABDService::Stub::PrepareAsyncReleaseLocks>>;
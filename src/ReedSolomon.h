@@ -0,0 +1,255 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ABD_GF_X86 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define ABD_GF_NEON 1
+#endif
+
+// GF(2^8) arithmetic, polynomial x^8 + x^4 + x^3 + x^2 + 1 (0x11d) like most RS codecs
+namespace gf256 {
+
+struct Tables {
+    uint8_t exp[512];
+    uint8_t log[256];
+
+    Tables()
+    {
+        unsigned x = 1;
+        for (int i = 0; i < 255; ++i) {
+            exp[i] = static_cast<uint8_t>(x);
+            log[x] = static_cast<uint8_t>(i);
+            x <<= 1;
+            if (x & 0x100) x ^= 0x11d;
+        }
+        for (int i = 255; i < 512; ++i) exp[i] = exp[i - 255];
+        log[0] = 0; // never looked at, Mul/Inv special-case 0
+    }
+};
+
+inline const Tables& T()
+{
+    static const Tables tables;
+    return tables;
+}
+
+inline uint8_t Mul(uint8_t a, uint8_t b)
+{
+    if (a == 0 || b == 0) return 0;
+    return T().exp[T().log[a] + T().log[b]];
+}
+
+inline uint8_t Inv(uint8_t a)
+{
+    return T().exp[255 - T().log[a]]; // a != 0
+}
+
+// dst[i] ^= c * src[i], the inner loop of both encode and decode. The vector versions use
+// the usual split-table trick: c*x = c*(x & 0x0f) ^ c*(x & 0xf0), two 16-entry tables
+// looked up 16 bytes at a time with a byte shuffle.
+inline void MulAddScalar(uint8_t* dst, const uint8_t* src, uint8_t c, size_t len)
+{
+    if (c == 0) return;
+    const uint8_t lc = T().log[c];
+    for (size_t i = 0; i < len; ++i) {
+        if (src[i]) dst[i] ^= T().exp[lc + T().log[src[i]]];
+    }
+}
+
+inline void NibbleTables(uint8_t c, uint8_t lo[16], uint8_t hi[16])
+{
+    for (int i = 0; i < 16; ++i) {
+        lo[i] = Mul(c, static_cast<uint8_t>(i));
+        hi[i] = Mul(c, static_cast<uint8_t>(i << 4));
+    }
+}
+
+#if defined(ABD_GF_X86)
+__attribute__((target("ssse3"))) inline void MulAddSsse3(uint8_t* dst, const uint8_t* src, uint8_t c, size_t len)
+{
+    alignas(16) uint8_t lo[16], hi[16];
+    NibbleTables(c, lo, hi);
+    const __m128i tlo = _mm_load_si128(reinterpret_cast<const __m128i*>(lo));
+    const __m128i thi = _mm_load_si128(reinterpret_cast<const __m128i*>(hi));
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i l = _mm_shuffle_epi8(tlo, _mm_and_si128(x, mask));
+        __m128i h = _mm_shuffle_epi8(thi, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(d, _mm_xor_si128(l, h)));
+    }
+    MulAddScalar(dst + i, src + i, c, len - i);
+}
+
+// picked once; the binary itself is built without -mssse3 so it still runs anywhere
+inline bool HaveSsse3()
+{
+    static const bool have = __builtin_cpu_supports("ssse3");
+    return have;
+}
+#endif
+
+#if defined(ABD_GF_NEON)
+inline void MulAddNeon(uint8_t* dst, const uint8_t* src, uint8_t c, size_t len)
+{
+    uint8_t lo[16], hi[16];
+    NibbleTables(c, lo, hi);
+    const uint8x16_t tlo = vld1q_u8(lo);
+    const uint8x16_t thi = vld1q_u8(hi);
+    const uint8x16_t mask = vdupq_n_u8(0x0f);
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t x = vld1q_u8(src + i);
+        uint8x16_t l = vqtbl1q_u8(tlo, vandq_u8(x, mask));
+        uint8x16_t h = vqtbl1q_u8(thi, vshrq_n_u8(x, 4));
+        vst1q_u8(dst + i, veorq_u8(vld1q_u8(dst + i), veorq_u8(l, h)));
+    }
+    MulAddScalar(dst + i, src + i, c, len - i);
+}
+#endif
+
+inline void MulAdd(uint8_t* dst, const uint8_t* src, uint8_t c, size_t len)
+{
+    if (c == 0) return;
+    if (c == 1) {
+        for (size_t i = 0; i < len; ++i) dst[i] ^= src[i];
+        return;
+    }
+#if defined(ABD_GF_X86)
+    if (HaveSsse3()) return MulAddSsse3(dst, src, c, len);
+#elif defined(ABD_GF_NEON)
+    return MulAddNeon(dst, src, c, len);
+#endif
+    MulAddScalar(dst, src, c, len);
+}
+
+} // namespace gf256
+
+// Systematic [n, k] Reed-Solomon: a value is cut into k equal data fragments (zero-padded)
+// and n - k parity fragments are added; any k of the n get the value back. Generator is
+// identity on top of a Cauchy matrix, so every k x k submatrix is invertible. n <= 256.
+class ReedSolomon {
+public:
+    ReedSolomon(int n, int k) : n_(n), k_(k), gen_(static_cast<size_t>(n) * k)
+    {
+        for (int r = 0; r < n_; ++r) {
+            for (int c = 0; c < k_; ++c) {
+                uint8_t v;
+                if (r < k_) {
+                    v = (r == c) ? 1 : 0;
+                } else {
+                    // Cauchy entry 1 / (x_r + y_c), x = {k..n-1}, y = {0..k-1} (+ is xor)
+                    v = gf256::Inv(static_cast<uint8_t>(r ^ c));
+                }
+                gen_[static_cast<size_t>(r) * k_ + c] = v;
+            }
+        }
+    }
+
+    int N() const { return n_; }
+    int K() const { return k_; }
+
+    static size_t FragmentSize(size_t value_size, int k) { return (value_size + k - 1) / k; }
+
+    void Encode(const std::string& value, std::vector<std::string>& fragments) const
+    {
+        const size_t len = FragmentSize(value.size(), k_);
+        fragments.resize(n_);
+        for (int i = 0; i < k_; ++i) {
+            fragments[i].assign(len, '\0');
+            size_t off = static_cast<size_t>(i) * len;
+            if (off < value.size()) {
+                std::memcpy(&fragments[i][0], value.data() + off, std::min(len, value.size() - off));
+            }
+        }
+        for (int r = k_; r < n_; ++r) {
+            fragments[r].assign(len, '\0');
+            uint8_t* out = Bytes(fragments[r]);
+            for (int c = 0; c < k_; ++c) {
+                gf256::MulAdd(out, Bytes(fragments[c]), gen_[static_cast<size_t>(r) * k_ + c], len);
+            }
+        }
+    }
+
+    // `index[i]` is which fragment `frags[i]` is; needs exactly k distinct ones of equal size
+    bool Decode(const std::vector<int>& index, const std::vector<const std::string*>& frags,
+                size_t value_size, std::string& value_out) const
+    {
+        if (static_cast<int>(index.size()) != k_ || frags.size() != index.size()) return false;
+        const size_t len = frags[0]->size();
+        if (len < FragmentSize(value_size, k_)) return false;
+
+        // rows of the generator we have, inverted: data = inv * received
+        std::vector<uint8_t> m(static_cast<size_t>(k_) * k_);
+        for (int i = 0; i < k_; ++i) {
+            if (frags[i]->size() != len) return false;
+            std::memcpy(&m[static_cast<size_t>(i) * k_], &gen_[static_cast<size_t>(index[i]) * k_], k_);
+        }
+        std::vector<uint8_t> inv;
+        if (!Invert(m, inv)) return false;
+
+        value_out.assign(len * k_, '\0');
+        uint8_t* out = Bytes(value_out);
+        for (int d = 0; d < k_; ++d) {
+            for (int i = 0; i < k_; ++i) {
+                gf256::MulAdd(out + static_cast<size_t>(d) * len,
+                              reinterpret_cast<const uint8_t*>(frags[i]->data()),
+                              inv[static_cast<size_t>(d) * k_ + i], len);
+            }
+        }
+        value_out.resize(value_size);
+        return true;
+    }
+
+private:
+    static uint8_t* Bytes(std::string& s) { return reinterpret_cast<uint8_t*>(&s[0]); }
+
+    // Gauss-Jordan over GF(2^8); false if singular (two copies of the same fragment)
+    bool Invert(std::vector<uint8_t> m, std::vector<uint8_t>& inv) const
+    {
+        const int k = k_;
+        inv.assign(static_cast<size_t>(k) * k, 0);
+        for (int i = 0; i < k; ++i) inv[static_cast<size_t>(i) * k + i] = 1;
+        for (int col = 0; col < k; ++col) {
+            int pivot = col;
+            while (pivot < k && m[static_cast<size_t>(pivot) * k + col] == 0) ++pivot;
+            if (pivot == k) return false;
+            if (pivot != col) {
+                for (int j = 0; j < k; ++j) {
+                    std::swap(m[static_cast<size_t>(pivot) * k + j], m[static_cast<size_t>(col) * k + j]);
+                    std::swap(inv[static_cast<size_t>(pivot) * k + j], inv[static_cast<size_t>(col) * k + j]);
+                }
+            }
+            const uint8_t scale = gf256::Inv(m[static_cast<size_t>(col) * k + col]);
+            for (int j = 0; j < k; ++j) {
+                m[static_cast<size_t>(col) * k + j] = gf256::Mul(m[static_cast<size_t>(col) * k + j], scale);
+                inv[static_cast<size_t>(col) * k + j] = gf256::Mul(inv[static_cast<size_t>(col) * k + j], scale);
+            }
+            for (int r = 0; r < k; ++r) {
+                const uint8_t f = m[static_cast<size_t>(r) * k + col];
+                if (r == col || f == 0) continue;
+                for (int j = 0; j < k; ++j) {
+                    m[static_cast<size_t>(r) * k + j] ^= gf256::Mul(f, m[static_cast<size_t>(col) * k + j]);
+                    inv[static_cast<size_t>(r) * k + j] ^= gf256::Mul(f, inv[static_cast<size_t>(col) * k + j]);
+                }
+            }
+        }
+        return true;
+    }
+
+    int n_;
+    int k_;
+    std::vector<uint8_t> gen_; // n x k, row-major
+};
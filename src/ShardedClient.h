@@ -0,0 +1,414 @@
+#pragma once
+
+#include "proto/abd.pb.h"
+#include "src/ClientCommon.h"
+#include "src/Consistency.h"
+#include "src/HashRing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Which group serves a key. Shared by every logical client of the process so a migration
+// (see Migration.h) can move all of them from one ring to the next at once. Group ids are
+// indices into the full group list the clients were built over; only some of them need
+// to be on the ring. Points are placed by group name, so swapping a group for a newer
+// generation of itself changes who serves its keys but not which keys it has.
+class Routing {
+public:
+    struct Table {
+        std::vector<int> current_ids;
+        HashRing current;
+        std::vector<int> next_ids;       // set while migrating
+        std::unique_ptr<HashRing> next;
+
+        int From(const std::string& key) const { return current_ids[current.GroupFor(key)]; }
+        int To(const std::string& key) const { return next ? next_ids[next->GroupFor(key)] : From(key); }
+    };
+
+    Routing(const std::vector<ServerGroup>& all, const std::vector<int>& active)
+    {
+        for (const auto& g : all) names_.push_back(g.name);
+        table_ = MakeTable(active, nullptr);
+    }
+
+    // Ops hold their snapshot until they return, so an op never sees the table change
+    std::shared_ptr<const Table> Snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return table_;
+    }
+
+    // Puts `next` up as the destination ring, then waits until no op is still routing by
+    // the old table. After this returns every write to a moving key goes to its new group.
+    void BeginMigration(const std::vector<int>& next)
+    {
+        // (no snapshot of our own may be alive across Install, it would wait on itself)
+        std::vector<int> cur = Snapshot()->current_ids;
+        Install(MakeTable(cur, &next));
+    }
+
+    // Copy is done: the destination ring becomes the only ring
+    void Flip()
+    {
+        std::vector<int> next = Snapshot()->next_ids;
+        Install(MakeTable(next, nullptr));
+    }
+
+private:
+    std::shared_ptr<const Table> MakeTable(const std::vector<int>& current, const std::vector<int>* next) const
+    {
+        auto t = std::make_shared<Table>(Table{current, HashRing(NamesOf(current)), {}, nullptr});
+        if (next) {
+            t->next_ids = *next;
+            t->next.reset(new HashRing(NamesOf(*next)));
+        }
+        return t;
+    }
+
+    std::vector<std::string> NamesOf(const std::vector<int>& ids) const
+    {
+        std::vector<std::string> names;
+        for (int id : ids) names.push_back(names_[id]);
+        return names;
+    }
+
+    void Install(std::shared_ptr<const Table> t)
+    {
+        std::weak_ptr<const Table> old;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            old = table_;
+            table_ = std::move(t);
+        }
+        while (!old.expired()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::vector<std::string> names_;
+    mutable std::mutex mu_;
+    std::shared_ptr<const Table> table_;
+};
+
+// Spreads keys over several replica groups: one Client (ABDClient or BlockingClient) per
+// group, keys routed by a shared Routing. Each key lives in exactly one group, so per-key
+// guarantees are whatever that group's protocol gives; there is nothing cross-key here.
+// With a single group this is a plain pass-through.
+template <typename Client>
+class ShardedClient {
+public:
+    explicit ShardedClient(const std::vector<ServerGroup>& groups)
+        : routing_(std::make_shared<Routing>(groups, AllIds(groups)))
+    {
+        for (const auto& g : groups) {
+            clients_.emplace_back(new Client(g.addrs));
+        }
+    }
+
+    // Logical client over shared per-group channels (see CreateGroupChannels). Pass the
+    // process-wide Routing when keys may migrate; by default every group is on the ring.
+    ShardedClient(const std::vector<ServerGroup>& groups,
+                  const std::vector<std::vector<std::shared_ptr<grpc::Channel>>>& channels,
+                  const std::string& client_id,
+                  std::shared_ptr<Routing> routing = nullptr)
+        : routing_(routing ? std::move(routing) : std::make_shared<Routing>(groups, AllIds(groups)))
+    {
+        for (size_t g = 0; g < groups.size(); ++g) {
+            clients_.emplace_back(new Client(groups[g].addrs, channels[g], client_id));
+        }
+    }
+
+    bool Put(const std::string& key, const std::string& value)
+    {
+        auto table = routing_->Snapshot();
+        const int from = table->From(key);
+        const int to = table->To(key);
+        if (from == to) return clients_[to]->Put(key, value);
+        if constexpr (Client::kDualRoute) {
+            return DualPut(from, to, key, value);
+        }
+        return RefuseMoving("PUT", key);
+    }
+
+    bool Get(const std::string& key, std::string& value_out,
+             Consistency level = Consistency::LINEARIZABLE)
+    {
+        auto table = routing_->Snapshot();
+        const int from = table->From(key);
+        const int to = table->To(key);
+        if (from == to) return clients_[to]->Get(key, value_out, level);
+        if constexpr (Client::kDualRoute) {
+            return DualGet(from, to, key, value_out, level);
+        }
+        return RefuseMoving("GET", key);
+    }
+
+    // Multi-key PUT (BlockingClient::MultiPut). Its atomicity comes from one group's
+    // locks, so every key has to be served by the same group; a batch spanning groups, or
+    // a key that is moving, is refused.
+    bool MultiPut(const std::vector<std::pair<std::string, std::string>>& writes)
+    {
+        if (writes.empty()) return true;
+        auto table = routing_->Snapshot();
+        const int g = table->From(writes.front().first);
+        for (const auto& w : writes) {
+            if (table->From(w.first) != table->To(w.first)) return RefuseMoving("MPUT", w.first);
+            if (table->From(w.first) != g) {
+                std::cerr << "MPUT refused: " << writes.front().first << " and " << w.first
+                          << " are not both in one group\n";
+                return false;
+            }
+        }
+        return clients_[g]->MultiPut(writes);
+    }
+
+    Client& Group(int g) { return *clients_[g]; }
+    int NumGroups() const { return static_cast<int>(clients_.size()); }
+
+    // Same R/W settings everywhere, majority defaults resolved per group size. Groups
+    // must have been checked with ValidateGroupQuorums.
+    void SetQuorums(const std::vector<ServerGroup>& groups, const QuorumConfig& quorums)
+    {
+        for (size_t g = 0; g < clients_.size(); ++g) {
+            QuorumConfig q = quorums;
+            ValidateQuorums(static_cast<int>(groups[g].addrs.size()), q);
+            clients_[g]->SetQuorums(q.R, q.W);
+        }
+    }
+
+    // Each group's servers.conf generation on its requests (ABDClient::SetGeneration)
+    void SetGenerations(const std::vector<ServerGroup>& groups)
+    {
+        for (size_t g = 0; g < clients_.size(); ++g) clients_[g]->SetGeneration(groups[g].generation);
+    }
+
+    // The rest just fans out; only instantiated for clients that have them
+    void SetVerbose(bool verbose)
+    {
+        for (auto& c : clients_) c->SetVerbose(verbose);
+    }
+    template <typename Owned>
+    void SetOwnedKeys(const Owned& owned)
+    {
+        for (auto& c : clients_) c->SetOwnedKeys(owned);
+    }
+    void SetOptimisticPuts(bool optimistic)
+    {
+        for (auto& c : clients_) c->SetOptimisticPuts(optimistic);
+    }
+    void SetCoordinated(bool coordinated)
+    {
+        for (auto& c : clients_) c->SetCoordinated(coordinated);
+    }
+    void SetDataFragments(int k)
+    {
+        for (auto& c : clients_) c->SetDataFragments(k);
+    }
+    void SetLockWait(int ms)
+    {
+        for (auto& c : clients_) c->SetLockWait(ms);
+    }
+    long LockRpcs() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->LockRpcs();
+        return n;
+    }
+    void SetLockBackoff(int base_us, int cap_us)
+    {
+        for (auto& c : clients_) c->SetLockBackoff(base_us, cap_us);
+    }
+    long LockAcquires() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->LockAcquires();
+        return n;
+    }
+    long LockRetries() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->LockRetries();
+        return n;
+    }
+    long LockHolderChanges() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->LockHolderChanges();
+        return n;
+    }
+    void SetLockCoordinator(bool coordinator)
+    {
+        for (auto& c : clients_) c->SetLockCoordinator(coordinator);
+    }
+    long FencedWrites() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->FencedWrites();
+        return n;
+    }
+    void SetLockSessions(int idle_ms)
+    {
+        for (auto& c : clients_) c->SetLockSessions(idle_ms);
+    }
+    long SessionOps() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->SessionOps();
+        return n;
+    }
+    long MultiPuts() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->MultiPuts();
+        return n;
+    }
+    long MultiPutKeys() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->MultiPutKeys();
+        return n;
+    }
+    long OrderedAcquires() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->OrderedAcquires();
+        return n;
+    }
+    void SetLease(int ms)
+    {
+        for (auto& c : clients_) c->SetLease(ms);
+    }
+    void SetFused(bool fused)
+    {
+        for (auto& c : clients_) c->SetFused(fused);
+    }
+    void SetSharedReads(bool shared)
+    {
+        for (auto& c : clients_) c->SetSharedReads(shared);
+    }
+    void SetSkipSettledWriteBack(bool skip)
+    {
+        for (auto& c : clients_) c->SetSkipSettledWriteBack(skip);
+    }
+    long WriteBacksSkipped() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->WriteBacksSkipped();
+        return n;
+    }
+    long LeaseRenewals() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->LeaseRenewals();
+        return n;
+    }
+    long LeasesLost() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->LeasesLost();
+        return n;
+    }
+    long OneRoundPuts() const
+    {
+        long n = 0;
+        for (const auto& c : clients_) n += c->OneRoundPuts();
+        return n;
+    }
+    // ops turned away because their key was mid-migration (clients without kDualRoute)
+    long MigratingRefusals() const { return migrating_refusals_; }
+
+private:
+    static std::vector<int> AllIds(const std::vector<ServerGroup>& groups)
+    {
+        std::vector<int> ids;
+        for (size_t g = 0; g < groups.size(); ++g) ids.push_back(static_cast<int>(g));
+        return ids;
+    }
+
+    static bool TagGreater(const abd::Tag& a, const abd::Tag& b)
+    {
+        if (a.counter() != b.counter()) return a.counter() > b.counter();
+        return a.client_id() > b.client_id();
+    }
+
+    // A client without a single-phase API can't keep a moving key consistent across two
+    // groups, so its op fails; the caller may retry once the migration has flipped.
+    bool RefuseMoving(const char* op, const std::string& key)
+    {
+        migrating_refusals_++;
+        std::cerr << std::string(op) + " " + key + " refused: key migrating, retry after the flip\n";
+        return false;
+    }
+
+    // Key is moving from -> to. Nothing new lands on `from` any more (BeginMigration
+    // drained that), so the latest value is the max over both groups, and writing it
+    // (or a new one above it) to `to` keeps every later reader of `to` at least there.
+    bool DualPut(int from, int to, const std::string& key, const std::string& value)
+    {
+        abd::Tag old_tag, new_tag;
+        std::string ignored;
+        if (!clients_[from]->ReadLatest(key, old_tag, ignored)) return false;
+        if (!clients_[to]->ReadLatest(key, new_tag, ignored)) return false;
+
+        abd::Tag tag = TagGreater(old_tag, new_tag) ? old_tag : new_tag;
+        tag.set_counter(tag.counter() + 1);
+        tag.set_client_id(clients_[to]->ClientId());
+        return clients_[to]->Propagate(key, tag, value);
+    }
+
+    bool DualGet(int from, int to, const std::string& key, std::string& value_out, Consistency level)
+    {
+        abd::Tag old_tag, new_tag;
+        std::string old_value, new_value;
+        if (!clients_[from]->ReadLatest(key, old_tag, old_value)) return false;
+        if (!clients_[to]->ReadLatest(key, new_tag, new_value)) return false;
+
+        const bool old_wins = TagGreater(old_tag, new_tag);
+        value_out = old_wins ? old_value : new_value;
+        if (level != Consistency::LINEARIZABLE) return true;
+        // write-back goes to the destination, which is where the key will live
+        return clients_[to]->Propagate(key, old_wins ? old_tag : new_tag, value_out);
+    }
+
+    std::shared_ptr<Routing> routing_;
+    std::vector<std::unique_ptr<Client>> clients_;
+    long migrating_refusals_ = 0;
+};
+
+// "a", or "a@2" for a later generation of it
+inline std::string GroupLabel(const ServerGroup& g)
+{
+    return g.generation > 1 ? g.name + "@" + std::to_string(g.generation) : g.name;
+}
+
+// Startup check of the R/W settings against every group's size
+inline bool ValidateGroupQuorums(const std::vector<ServerGroup>& groups, const QuorumConfig& quorums)
+{
+    for (const auto& g : groups) {
+        QuorumConfig q = quorums;
+        if (!ValidateQuorums(static_cast<int>(g.addrs.size()), q)) {
+            std::cerr << "  (group " << GroupLabel(g) << ")\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// "N=3 R=2 W=2" for one group, "2 groups: a N=3 R=2 W=2, b N=5 R=3 W=3" otherwise
+inline std::string DescribeGroupQuorums(const std::vector<ServerGroup>& groups, const QuorumConfig& quorums)
+{
+    std::ostringstream out;
+    if (groups.size() > 1) out << groups.size() << " groups: ";
+    for (size_t g = 0; g < groups.size(); ++g) {
+        QuorumConfig q = quorums;
+        ValidateQuorums(static_cast<int>(groups[g].addrs.size()), q);
+        if (g > 0) out << ", ";
+        if (groups.size() > 1) out << GroupLabel(groups[g]) << " ";
+        out << "N=" << groups[g].addrs.size() << " R=" << q.R << " W=" << q.W;
+    }
+    return out.str();
+}
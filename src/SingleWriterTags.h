@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Single-writer (SWMR) ABD for keys this process owns, picked by prefix. The owner is the
+// only one ever writing those keys, so it doesn't need a WriteQuery to find the max tag:
+// it keeps the counter itself and a PUT is a single WriteProp round.
+//
+// The one thing we can't know locally is where a previous run left off, so the first PUT
+// on an owned key still does the WriteQuery (recovery) and seeds the counter from it.
+// Shared by every client object of the process (ParallelReplay hands a key's ops to
+// whichever slot is free), hence the lock.
+//
+// Ownership is a promise, not something we check: a second writer on an owned key can
+// have its writes silently lose to ours or vice versa.
+class SingleWriterTags {
+public:
+    explicit SingleWriterTags(std::vector<std::string> prefixes) : prefixes_(std::move(prefixes)) {}
+
+    bool Owns(const std::string& key) const
+    {
+        for (const auto& p : prefixes_) {
+            if (key.compare(0, p.size(), p) == 0) return true;
+        }
+        return false;
+    }
+
+    // Next counter for an owned key, false if it hasn't been recovered yet this run
+    bool Next(const std::string& key, uint64_t& counter)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = last_.find(key);
+        if (it == last_.end()) return false;
+        counter = ++it->second;
+        return true;
+    }
+
+    // Recovery query came back; `counter` is what the caller is about to write with
+    void Recovered(const std::string& key, uint64_t counter)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        uint64_t& last = last_[key];
+        if (counter > last) last = counter;
+    }
+
+    const std::vector<std::string>& Prefixes() const { return prefixes_; }
+
+private:
+    const std::vector<std::string> prefixes_;
+    std::mutex mu_;
+    std::unordered_map<std::string, uint64_t> last_;
+};
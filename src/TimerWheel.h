@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Hashed timing wheel (Varghese & Lauck): time is cut into ticks, an item goes in slot
+// (its deadline tick % slots), and Advance() visits the slots whose ticks went by since
+// last time and fires what's due there. Items more than one turn out share a slot with
+// nearer ones and just stay put until their own turn comes up. Schedule is O(1) and there
+// is no per-item timer, so thousands of leases cost one periodic wakeup.
+//
+// Not thread safe, and items can't be cancelled: keep something in T that lets the
+// callback tell a stale item (released lock, renewed lease) from a live one.
+template <typename T>
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TimerWheel(Clock::duration tick, size_t slots)
+        : tick_(tick), slots_(slots), start_(Clock::now()) {}
+
+    Clock::duration Tick() const { return tick_; }
+    size_t Size() const { return size_; }
+
+    // fires on the first Advance at or after `when` (rounded up to a tick)
+    void Schedule(Clock::time_point when, T item)
+    {
+        uint64_t t = TickOf(when + tick_ - Clock::duration(1));
+        if (t <= current_) t = current_ + 1; // already due: next tick
+        slots_[t % slots_.size()].push_back({t, std::move(item)});
+        size_++;
+    }
+
+    // fire(T&) may Schedule() again (e.g. a renewed lease going back in)
+    template <typename Fire>
+    void Advance(Clock::time_point now, Fire fire)
+    {
+        const uint64_t target = TickOf(now);
+        // behind by more than a turn: one pass over every slot catches all of it
+        if (target > current_ + slots_.size()) current_ = target - slots_.size();
+        while (current_ < target) {
+            ++current_;
+            std::vector<Item>& slot = slots_[current_ % slots_.size()];
+            for (size_t i = 0; i < slot.size();) {
+                if (slot[i].tick > current_) {
+                    ++i;
+                    continue;
+                }
+                T item = std::move(slot[i].item);
+                slot[i] = std::move(slot.back());
+                slot.pop_back();
+                size_--;
+                fire(item);
+            }
+        }
+    }
+
+private:
+    struct Item {
+        uint64_t tick;
+        T item;
+    };
+
+    uint64_t TickOf(Clock::time_point t) const
+    {
+        if (t <= start_) return 0;
+        return static_cast<uint64_t>((t - start_) / tick_);
+    }
+
+    Clock::duration tick_;
+    std::vector<std::vector<Item>> slots_;
+    Clock::time_point start_;
+    uint64_t current_ = 0; // last tick Advance got through
+    size_t size_ = 0;
+};
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Small work-stealing pool for the load driver. Every worker owns a deque: it pushes
+// and pops its own work at the back (so a logical client's next op usually stays on the
+// thread that just ran the previous one) and idle workers steal from the front of others.
+// Tasks get the index of the worker running them so they can use per-worker state.
+class WorkStealingPool {
+public:
+    using Task = std::function<void(int worker)>;
+
+    explicit WorkStealingPool(int num_workers)
+    {
+        if (num_workers < 1) num_workers = 1;
+        for (int i = 0; i < num_workers; ++i) {
+            queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (int i = 0; i < num_workers; ++i) {
+            threads_.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(idle_mu_);
+            stop_ = true;
+        }
+        idle_cv_.notify_all();
+        for (auto& t : threads_) t.join();
+    }
+
+    int NumWorkers() const { return static_cast<int>(queues_.size()); }
+
+    // From outside the pool: spread round-robin. From inside a task: pass the running
+    // worker's index so the continuation lands on its own deque.
+    void Submit(Task task, int worker = -1)
+    {
+        if (worker < 0) {
+            worker = static_cast<int>(next_queue_.fetch_add(1) % queues_.size());
+        }
+        pending_.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(queues_[worker]->mu);
+            queues_[worker]->tasks.push_back(std::move(task));
+        }
+        idle_cv_.notify_one();
+    }
+
+    // Blocks until every submitted task (including ones submitted by tasks) has finished
+    void WaitIdle()
+    {
+        std::unique_lock<std::mutex> lock(idle_mu_);
+        done_cv_.wait(lock, [this] { return pending_.load() == 0; });
+    }
+
+    long Steals() const { return steals_.load(); }
+
+private:
+    struct WorkerQueue {
+        std::mutex mu;
+        std::deque<Task> tasks;
+    };
+
+    bool PopLocal(int worker, Task& out)
+    {
+        WorkerQueue& q = *queues_[worker];
+        std::lock_guard<std::mutex> lock(q.mu);
+        if (q.tasks.empty()) return false;
+        out = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        return true;
+    }
+
+    bool Steal(int thief, Task& out)
+    {
+        int n = static_cast<int>(queues_.size());
+        for (int k = 1; k < n; ++k) {
+            WorkerQueue& q = *queues_[(thief + k) % n];
+            std::lock_guard<std::mutex> lock(q.mu);
+            if (q.tasks.empty()) continue;
+            out = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            steals_.fetch_add(1);
+            return true;
+        }
+        return false;
+    }
+
+    void WorkerLoop(int worker)
+    {
+        while (true) {
+            Task task;
+            if (PopLocal(worker, task) || Steal(worker, task)) {
+                task(worker);
+                if (pending_.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(idle_mu_);
+                    done_cv_.notify_all();
+                }
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(idle_mu_);
+            if (stop_) return;
+            // short timed wait: a submit can race with us going to sleep, and the
+            // thief scan is cheap enough to just redo
+            idle_cv_.wait_for(lock, std::chrono::milliseconds(1));
+            if (stop_) return;
+        }
+    }
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> next_queue_{0};
+    std::atomic<long> pending_{0};
+    std::atomic<long> steals_{0};
+
+    std::mutex idle_mu_;
+    std::condition_variable idle_cv_;
+    std::condition_variable done_cv_;
+    bool stop_ = false;
+};